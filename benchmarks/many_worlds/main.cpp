@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "SubzeroECS/StaticWorld.hpp"
+#include "SubzeroECS/System.hpp"
+#include "SubzeroECS/WorldGroup.hpp"
+
+// ============================================================================
+// Stepping many small worlds (e.g. one per server shard or match)
+// ============================================================================
+
+struct Position {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct Velocity {
+    float dx = 0.0f;
+    float dy = 0.0f;
+};
+
+using ShardWorld = SubzeroECS::StaticWorld<Position, Velocity>;
+using ShardGroup = SubzeroECS::WorldGroup<Position, Velocity>;
+
+constexpr float DeltaTime = 1.0f / 60.0f;
+
+class MovementSystem : public SubzeroECS::System<MovementSystem, Position, Velocity> {
+public:
+    template<typename WorldType>
+    MovementSystem(WorldType& world, float deltaTime)
+        : SubzeroECS::System<MovementSystem, Position, Velocity>(world)
+        , deltaTime_(deltaTime) {}
+
+    void processEntity(Position& pos, Velocity& vel) {
+        pos.x += vel.dx * deltaTime_;
+        pos.y += vel.dy * deltaTime_;
+        if (pos.x < 0.0f || pos.x > 1000.0f) vel.dx = -vel.dx;
+        if (pos.y < 0.0f || pos.y > 1000.0f) vel.dy = -vel.dy;
+    }
+
+private:
+    float deltaTime_;
+};
+
+static void populate(ShardWorld& world, int64_t entityCount, std::mt19937& gen) {
+    std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> velocity(-10.0f, 10.0f);
+    for (int64_t i = 0; i < entityCount; ++i) {
+        (void)world.create(Position{position(gen), position(gen)}, Velocity{velocity(gen), velocity(gen)});
+    }
+}
+
+// Each world stepped in turn by a System constructed for that step, the per-world fixed cost baseline
+static void BM_StepRebuildSystems(benchmark::State& state) {
+    const int64_t worldCount = state.range(0);
+    const int64_t entityCount = state.range(1);
+    std::mt19937 gen(42);
+    std::vector<std::unique_ptr<ShardWorld>> worlds;
+    for (int64_t i = 0; i < worldCount; ++i) {
+        populate(*worlds.emplace_back(std::make_unique<ShardWorld>()), entityCount, gen);
+    }
+
+    for (auto _ : state) {
+        for (std::unique_ptr<ShardWorld>& world : worlds) {
+            MovementSystem system(*world, DeltaTime);
+            system.update();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * worldCount * entityCount);
+}
+
+// WorldGroup::update() with systems built once per world, on threadCount threads (0 for hardware concurrency)
+static void BM_StepWorldGroup(benchmark::State& state, size_t threadCount) {
+    const int64_t worldCount = state.range(0);
+    const int64_t entityCount = state.range(1);
+    std::mt19937 gen(42);
+    ShardGroup group(threadCount);
+    group.addSystem<MovementSystem>(DeltaTime);
+    for (int64_t i = 0; i < worldCount; ++i) {
+        populate(group.createWorld(), entityCount, gen);
+    }
+
+    for (auto _ : state) {
+        group.update();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * worldCount * entityCount);
+    state.counters["threads"] = static_cast<double>(group.threadCount());
+}
+
+// ============================================================================
+// Benchmark Registration
+// ============================================================================
+
+#define REGISTER_SHARD_BENCHMARKS(Worlds, Entities) \
+    BENCHMARK(BM_StepRebuildSystems)->Args({Worlds, Entities})->Unit(benchmark::kMicrosecond)->UseRealTime(); \
+    BENCHMARK_CAPTURE(BM_StepWorldGroup, SingleThread, 1)->Args({Worlds, Entities})->Unit(benchmark::kMicrosecond)->UseRealTime(); \
+    BENCHMARK_CAPTURE(BM_StepWorldGroup, ThreadPool, 0)->Args({Worlds, Entities})->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+REGISTER_SHARD_BENCHMARKS(1000, 100)
+REGISTER_SHARD_BENCHMARKS(1000, 1000)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/System.hpp"
+#include "SubzeroECS/World.hpp"
+
+// ============================================================================
+// Sequential streaming over memory-mapped file columns versus in-memory columns
+// e.g. historical replay and batch simulation of worlds larger than memory
+// ============================================================================
+
+template<bool Mapped>
+struct Position {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+template<bool Mapped>
+struct Velocity {
+    float dx = 0.0f;
+    float dy = 0.0f;
+};
+
+template<> struct SubzeroECS::ComponentStorage<Position<true>> : SubzeroECS::MappedFileStorage {};
+template<> struct SubzeroECS::ComponentStorage<Velocity<true>> : SubzeroECS::MappedFileStorage {};
+
+template<bool Mapped>
+class MovementSystem : public SubzeroECS::System<MovementSystem<Mapped>, Position<Mapped>, Velocity<Mapped>> {
+public:
+    explicit MovementSystem(SubzeroECS::World& world)
+        : SubzeroECS::System<MovementSystem<Mapped>, Position<Mapped>, Velocity<Mapped>>(world) {}
+
+    void processEntity(Position<Mapped>& pos, const Velocity<Mapped>& vel) {
+        pos.x += vel.dx * (1.0f / 60.0f);
+        pos.y += vel.dy * (1.0f / 60.0f);
+    }
+};
+
+// World of Position + Velocity entities stored in memory or in mapped files
+template<bool Mapped>
+class StorageWorld {
+public:
+    explicit StorageWorld(int64_t entityCount)
+        : collections_(world_)
+        , system_(world_)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+        for (int64_t i = 0; i < entityCount; ++i) {
+            world_.create(Position<Mapped>{dist(gen), dist(gen)}, Velocity<Mapped>{dist(gen), dist(gen)});
+        }
+    }
+
+    void update() { system_.update(); }
+
+private:
+    SubzeroECS::World world_;
+    SubzeroECS::Collection<Position<Mapped>, Velocity<Mapped>> collections_;
+    MovementSystem<Mapped> system_;
+};
+
+// One sequential pass of the movement system over every entity
+template<bool Mapped>
+static void BM_Stream(benchmark::State& state) {
+    StorageWorld<Mapped> world(state.range(0));
+    for (auto _ : state) {
+        world.update();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0)
+        * int64_t(2 * sizeof(SubzeroECS::EntityId) + sizeof(Position<Mapped>) + sizeof(Velocity<Mapped>)));
+}
+
+// Appending entities, growing the columns by reallocation or by ftruncate and remap
+template<bool Mapped>
+static void BM_Append(benchmark::State& state) {
+    for (auto _ : state) {
+        StorageWorld<Mapped> world(state.range(0));
+        benchmark::DoNotOptimize(world);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// ============================================================================
+// Benchmark Registration
+// ============================================================================
+
+#define REGISTER_SIZE_BENCHMARKS(Size) \
+    BENCHMARK(BM_Stream<false>)->Name("BM_Stream/Vector")->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK(BM_Stream<true>)->Name("BM_Stream/MappedFile")->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK(BM_Append<false>)->Name("BM_Append/Vector")->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK(BM_Append<true>)->Name("BM_Append/MappedFile")->Arg(Size)->Unit(benchmark::kMicrosecond);
+
+REGISTER_SIZE_BENCHMARKS(100000)
+REGISTER_SIZE_BENCHMARKS(1000000)
+REGISTER_SIZE_BENCHMARKS(10000000)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,162 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/Join.hpp"
+#include "SubzeroECS/World.hpp"
+
+// ============================================================================
+// Random access lookup of components through entity references
+// e.g. following targets, parents or collision partners
+// ============================================================================
+
+struct Position {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct Target {
+    SubzeroECS::EntityId id;
+};
+
+// Position looked up through a SearchIndex instead of a binary search
+struct IndexedPosition {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+template<> struct SubzeroECS::ComponentSearchIndex<IndexedPosition> : std::true_type {};
+
+// World of entities with Position and a Target referencing a random entity
+// The references are also kept as a list of entity ids to look up, shuffled or sorted
+class ReferenceWorld {
+public:
+    ReferenceWorld(int64_t entityCount, bool sortedReferences)
+        : collections_(world_)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+        std::vector<SubzeroECS::EntityId> entityIds;
+        entityIds.reserve(entityCount);
+        for (int64_t i = 0; i < entityCount; ++i) {
+            entityIds.push_back(world_.create(Position{dist(gen), dist(gen)}).id());
+        }
+
+        // Each entity references one random entity
+        std::uniform_int_distribution<size_t> pick(0, entityIds.size() - 1);
+        references_.reserve(entityCount);
+        for (int64_t i = 0; i < entityCount; ++i) {
+            references_.push_back(entityIds[pick(gen)]);
+            world_.add(entityIds[i], Target{references_.back()});
+        }
+        if (sortedReferences) {
+            std::sort(references_.begin(), references_.end());
+        }
+    }
+
+    SubzeroECS::World& world() { return world_; }
+    const std::vector<SubzeroECS::EntityId>& references() const { return references_; }
+
+private:
+    SubzeroECS::World world_;
+    SubzeroECS::Collection<Position, Target> collections_;
+    std::vector<SubzeroECS::EntityId> references_;
+};
+
+// One World::get() binary search per reference
+static void BM_GetEach(benchmark::State& state, bool sortedReferences) {
+    ReferenceWorld referenceWorld(state.range(0), sortedReferences);
+    SubzeroECS::World& world = referenceWorld.world();
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (SubzeroECS::EntityId entityId : referenceWorld.references()) {
+            sum += world.get<Position>(entityId).x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * referenceWorld.references().size());
+}
+
+// All references resolved in one World::getMany() pass
+static void BM_GetMany(benchmark::State& state, bool sortedReferences) {
+    ReferenceWorld referenceWorld(state.range(0), sortedReferences);
+    SubzeroECS::World& world = referenceWorld.world();
+    std::vector<Position*> positions(referenceWorld.references().size());
+
+    for (auto _ : state) {
+        world.getMany<Position>(referenceWorld.references(), positions);
+        float sum = 0.0f;
+        for (const Position* position : positions) {
+            sum += position->x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * referenceWorld.references().size());
+}
+
+// Following each entity's Target with Join<Via<&Target::id>, Position>
+static void BM_JoinEach(benchmark::State& state) {
+    ReferenceWorld referenceWorld(state.range(0), false);
+    SubzeroECS::Join<SubzeroECS::Via<&Target::id>, Position> join(referenceWorld.world());
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        join.each([&](SubzeroECS::EntityId, Target&, Position& targetPosition) {
+            sum += targetPosition.x;
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * referenceWorld.references().size());
+}
+
+// One Collection::get() per shuffled id, over entities stride ids apart
+// Dense ids (stride 1) use interpolation search when indexed, sparse ids a static B+-tree
+template<typename PositionType>
+static void BM_CollectionGet(benchmark::State& state, uint32_t stride) {
+    SubzeroECS::CollectionRegistry registry;
+    SubzeroECS::Collection<PositionType> positions(registry);
+    std::vector<SubzeroECS::EntityId> entityIds;
+    entityIds.reserve(state.range(0));
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        entityIds.push_back(SubzeroECS::EntityId{static_cast<uint32_t>(i) * stride});
+        positions.create(entityIds.back(), PositionType{static_cast<float>(i), 0.0f});
+    }
+    std::shuffle(entityIds.begin(), entityIds.end(), std::mt19937(42));
+    if constexpr (SubzeroECS::Collection<PositionType>::HasSearchIndex) {
+        positions.buildSearchIndex();
+    }
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (SubzeroECS::EntityId entityId : entityIds) {
+            sum += positions.get(entityId).x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * entityIds.size());
+}
+
+// ============================================================================
+// Benchmark Registration
+// ============================================================================
+
+#define REGISTER_SIZE_BENCHMARKS(Size) \
+    BENCHMARK_CAPTURE(BM_GetEach, Shuffled, false)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_GetMany, Shuffled, false)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_GetEach, Sorted, true)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_GetMany, Sorted, true)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK(BM_JoinEach)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_CollectionGet<Position>, Dense, 1U)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_CollectionGet<IndexedPosition>, IndexedDense, 1U)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_CollectionGet<Position>, Sparse, 8U)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_CollectionGet<IndexedPosition>, IndexedSparse, 8U)->Arg(Size)->Unit(benchmark::kMicrosecond);
+
+REGISTER_SIZE_BENCHMARKS(1000)
+REGISTER_SIZE_BENCHMARKS(100000)
+REGISTER_SIZE_BENCHMARKS(1000000)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "SubzeroECS/Prefab.hpp"
+#include "SubzeroECS/StaticWorld.hpp"
+#include "SubzeroECS/World.hpp"
+
+// ============================================================================
+// Spawning many identical entities e.g. a volley of projectiles
+// ============================================================================
+
+struct Position {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct Velocity {
+    float dx = 0.0f;
+    float dy = 0.0f;
+};
+
+struct Lifetime {
+    float seconds = 0.0f;
+};
+
+using SpawnWorld = SubzeroECS::StaticWorld<Position, Velocity, Lifetime>;
+
+static const SubzeroECS::Prefab Projectile(Position{}, Velocity{0.0f, 10.0f}, Lifetime{2.0f});
+
+// One World::create() per entity, looking up each collection and inserting into each column
+static void BM_SpawnCreate_World(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    for (auto _ : state) {
+        SubzeroECS::World world;
+        SubzeroECS::Collection<Position, Velocity, Lifetime> collections(world);
+        for (int64_t i = 0; i < count; ++i) {
+            benchmark::DoNotOptimize(world.create(Position{}, Velocity{0.0f, 10.0f}, Lifetime{2.0f}));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// World::instantiate() of a Prefab, one collection lookup and one reserve and fill per column
+static void BM_SpawnInstantiate_World(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    for (auto _ : state) {
+        SubzeroECS::World world;
+        SubzeroECS::Collection<Position, Velocity, Lifetime> collections(world);
+        benchmark::DoNotOptimize(world.instantiate(Projectile, static_cast<std::size_t>(count)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_SpawnCreate_StaticWorld(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    for (auto _ : state) {
+        SpawnWorld world;
+        for (int64_t i = 0; i < count; ++i) {
+            benchmark::DoNotOptimize(world.create(Position{}, Velocity{0.0f, 10.0f}, Lifetime{2.0f}));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_SpawnInstantiate_StaticWorld(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    for (auto _ : state) {
+        SpawnWorld world;
+        benchmark::DoNotOptimize(world.instantiate(Projectile, static_cast<std::size_t>(count)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Instances customised by an init function, e.g. fanning the volley out by index
+static void BM_SpawnInstantiateInit_StaticWorld(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    for (auto _ : state) {
+        SpawnWorld world;
+        const SubzeroECS::EntityRange entities = world.instantiate(Projectile, static_cast<std::size_t>(count),
+            [first = world.get<Position>().size()](SubzeroECS::EntityId entityId, Position&, Velocity& velocity, Lifetime&) {
+                velocity.dx = static_cast<float>(entityId.value - first) * 0.01f;
+            });
+        benchmark::DoNotOptimize(entities);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// ============================================================================
+// Benchmark Registration
+// ============================================================================
+
+#define REGISTER_SPAWN_BENCHMARK(Function) \
+    BENCHMARK(Function)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+REGISTER_SPAWN_BENCHMARK(BM_SpawnCreate_World)
+REGISTER_SPAWN_BENCHMARK(BM_SpawnInstantiate_World)
+REGISTER_SPAWN_BENCHMARK(BM_SpawnCreate_StaticWorld)
+REGISTER_SPAWN_BENCHMARK(BM_SpawnInstantiate_StaticWorld)
+REGISTER_SPAWN_BENCHMARK(BM_SpawnInstantiateInit_StaticWorld)
+
+BENCHMARK_MAIN();
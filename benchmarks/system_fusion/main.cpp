@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/FusedSystem.hpp"
+#include "SubzeroECS/World.hpp"
+
+#include "Components.hpp"
+#include "ECS_Systems.hpp"
+
+// ============================================================================
+// Per-frame physics systems of the balls simulation sample run headless
+// Gravity, movement and boundary collision each stream Velocity
+// ============================================================================
+
+using namespace BallsSim;
+
+// World of balls with the gravity, movement and boundary systems
+class BallsWorld {
+public:
+    explicit BallsWorld(int64_t ballCount)
+        : collections_(world_)
+        , gravity_(world_)
+        , movement_(world_)
+        , boundary_(world_)
+        , fused_(world_, gravity_, movement_, boundary_)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> position(50.0f, 750.0f);
+        std::uniform_real_distribution<float> velocity(-200.0f, 200.0f);
+        for (int64_t i = 0; i < ballCount; ++i) {
+            world_.create(Position{position(gen), position(gen)}, Velocity{velocity(gen), velocity(gen)},
+                Radius{5.0f}, Mass{1.0f}, Color{255, 255, 255, 255});
+        }
+        gravity_.deltaTime = 1.0f / 60.0f;
+        movement_.deltaTime = 1.0f / 60.0f;
+    }
+
+    void updateSeparate() {
+        gravity_.update();
+        movement_.update();
+        boundary_.update();
+    }
+
+    void updateFused() {
+        fused_.update();
+    }
+
+private:
+    SubzeroECS::World world_;
+    SubzeroECS::Collection<Position, Velocity, Radius, Mass, Color> collections_;
+    GravitySystem gravity_;
+    MovementSystem movement_;
+    BoundaryCollisionSystem boundary_;
+    SubzeroECS::FusedSystem<GravitySystem, MovementSystem, BoundaryCollisionSystem> fused_;
+};
+
+// Each system updated in turn, three passes over the shared columns
+static void BM_SystemsSeparate(benchmark::State& state) {
+    BallsWorld world(state.range(0));
+    for (auto _ : state) {
+        world.updateSeparate();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// FusedSystem calling the three systems per entity in a single pass
+static void BM_SystemsFused(benchmark::State& state) {
+    BallsWorld world(state.range(0));
+    for (auto _ : state) {
+        world.updateFused();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// ============================================================================
+// Benchmark Registration
+// ============================================================================
+
+BENCHMARK(BM_SystemsSeparate)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SystemsFused)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
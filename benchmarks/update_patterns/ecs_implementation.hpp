@@ -1,6 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <execution>
+
+#include "SubzeroECS/BucketedSystem.hpp"
 #include "SubzeroECS/World.hpp"
+#include "SubzeroECS/StaticWorld.hpp"
 #include "SubzeroECS/System.hpp"
 #include "common.hpp"
 
@@ -54,7 +59,8 @@ class PhysicsSystem : public SubzeroECS::System<PhysicsSystem, Position, Velocit
 public:
     float deltaTime = 0.0f;
 
-    PhysicsSystem(SubzeroECS::World& world)
+    template<typename WorldType>
+    PhysicsSystem(WorldType& world)
         : SubzeroECS::System<PhysicsSystem, Position, Velocity>(world) {}
 
     void processEntity(Iterator iEntity) {
@@ -65,12 +71,62 @@ public:
     }
 };
 
+// Physics update system taking its components as parameters - iterated internally by View::each()
+class PhysicsEachSystem : public SubzeroECS::System<PhysicsEachSystem, Position, Velocity> {
+public:
+    float deltaTime = 0.0f;
+
+    template<typename WorldType>
+    PhysicsEachSystem(WorldType& world)
+        : SubzeroECS::System<PhysicsEachSystem, Position, Velocity>(world) {}
+
+    void processEntity(Position& pos, Velocity& vel) {
+        Physics::updatePosition(pos.x, pos.y, vel.dx, vel.dy, deltaTime);
+    }
+};
+
+// Physics update applied by a standard parallel algorithm over the random-access View::rows()
+class PhysicsParallelSystem {
+public:
+    float deltaTime = 0.0f;
+
+    template<typename WorldType>
+    PhysicsParallelSystem(WorldType& world)
+        : view_(world) {}
+
+    void update() {
+        auto rows = view_.rows();
+        std::for_each(std::execution::par_unseq, rows.begin(), rows.end(), [deltaTime = deltaTime](auto entity) {
+            auto [pos, vel] = entity;
+            Physics::updatePosition(pos.x, pos.y, vel.dx, vel.dy, deltaTime);
+        });
+    }
+
+private:
+    SubzeroECS::View<Position, Velocity> view_;
+};
+
+// Physics update at a per-entity rate chosen by an UpdateBucket tag, the time step is scaled by the bucket period
+class PhysicsBucketSystem : public SubzeroECS::BucketedSystem<PhysicsBucketSystem, 5, Position, Velocity> {
+public:
+    float deltaTime = 0.0f;
+
+    template<typename WorldType>
+    PhysicsBucketSystem(WorldType& world)
+        : SubzeroECS::BucketedSystem<PhysicsBucketSystem, 5, Position, Velocity>(world) {}
+
+    void processEntity(Position& pos, Velocity& vel) {
+        Physics::updatePosition(pos.x, pos.y, vel.dx, vel.dy, deltaTime * static_cast<float>(bucketPeriod()));
+    }
+};
+
 // Rotation and Health update system - processes Medium and Large entities
 class RotationHealthSystem : public SubzeroECS::System<RotationHealthSystem, Health, Rotation> {
 public:
     float deltaTime = 0.0f;
 
-    RotationHealthSystem(SubzeroECS::World& world)
+    template<typename WorldType>
+    RotationHealthSystem(WorldType& world)
         : SubzeroECS::System<RotationHealthSystem, Health, Rotation>(world) {}
 
     void processEntity(Iterator iEntity) {
@@ -86,7 +142,8 @@ class ScalePulseSystem : public SubzeroECS::System<ScalePulseSystem, Scale, Colo
 public:
     float deltaTime = 0.0f;
 
-    ScalePulseSystem(SubzeroECS::World& world)
+    template<typename WorldType>
+    ScalePulseSystem(WorldType& world)
         : SubzeroECS::System<ScalePulseSystem, Scale, Color>(world) {}
 
     void processEntity(Iterator iEntity) {
@@ -98,9 +155,10 @@ public:
 };
 
 // World wrapper for easier management
-class EntityWorld {
+template<typename PhysicsSystemType>
+class BasicEntityWorld {
 public:
-    EntityWorld() 
+    BasicEntityWorld() 
         : collections_(world_)
         , physicsSystem_(world_)
         , rotationHealthSystem_(world_)
@@ -137,6 +195,22 @@ public:
 #endif
     }
 
+    // Number of entities with Health, Rotation and Scale (Medium and Large) counted by View::count()
+    size_t countMedium() {
+        SubzeroECS::View<Health, Rotation, Scale> view(world_);
+        return view.count();
+    }
+
+    // Number of entities with Health, Rotation and Scale counted by walking the View iterator
+    size_t countMediumIterated() {
+        SubzeroECS::View<Health, Rotation, Scale> view(world_);
+        size_t result = 0;
+        for (auto iEntity = view.begin(); iEntity != view.end(); ++iEntity) {
+            ++result;
+        }
+        return result;
+    }
+
     size_t count() const {
         const SubzeroECS::Collection<Position>& posCollection = 
             const_cast<SubzeroECS::World&>(world_).CollectionRegistry::get<Position>();
@@ -146,9 +220,107 @@ public:
 private:
     SubzeroECS::World world_;
     SubzeroECS::Collection<Position, Velocity, Health, Rotation, Scale, Color, Team, Flags> collections_;
+    PhysicsSystemType physicsSystem_;
+    RotationHealthSystem rotationHealthSystem_;
+    ScalePulseSystem scalePulseSystem_;
+};
+
+using EntityWorld = BasicEntityWorld<PhysicsSystem>;
+using EachEntityWorld = BasicEntityWorld<PhysicsEachSystem>;
+using ParallelEntityWorld = BasicEntityWorld<PhysicsParallelSystem>;
+
+// StaticWorld variant - identical entities and systems with collections resolved at compile-time
+class StaticEntityWorld {
+public:
+    using WorldType = SubzeroECS::StaticWorld<Position, Velocity, Health, Rotation, Scale, Color, Team, Flags>;
+
+    StaticEntityWorld()
+        : physicsSystem_(world_)
+        , rotationHealthSystem_(world_)
+        , scalePulseSystem_(world_)
+    {}
+
+    void addEntity(float x, float y, float vx, float vy, EntityType entityType = EntityType::Small) {
+        switch (entityType) {
+            case EntityType::Small:
+                world_.create(Position{x, y}, Velocity{vx, vy});
+                break;
+            case EntityType::Medium:
+                world_.create(Position{x, y}, Velocity{vx, vy}, Health{}, Rotation{}, Scale{});
+                break;
+            case EntityType::Large:
+                world_.create(Position{x, y}, Velocity{vx, vy}, Health{}, Rotation{}, Scale{}, Color{}, Team{}, Flags{});
+                break;
+        }
+    }
+
+    void updateAll(float deltaTime) {
+        physicsSystem_.deltaTime = deltaTime;
+        physicsSystem_.update();
+    }
+
+    size_t count() const {
+        return world_.get<Position>().size();
+    }
+
+private:
+    WorldType world_;
     PhysicsSystem physicsSystem_;
     RotationHealthSystem rotationHealthSystem_;
     ScalePulseSystem scalePulseSystem_;
 };
 
+// Share of entities in each update bucket (every frame, 2nd, 4th, 8th, 16th)
+enum class BucketDistribution {
+    EveryFrame, // All entities updated every frame
+    Mixed,      // 25% each in the every frame, 2nd, 4th and 8th frame buckets
+    Distant     // 10% every frame, 20% every 4th, 70% every 16th frame
+};
+
+inline size_t getBucketLevel(int64_t index, BucketDistribution distribution) {
+    const int64_t percent = index % 100;
+    switch (distribution) {
+        case BucketDistribution::EveryFrame: return 0;
+        case BucketDistribution::Mixed: return static_cast<size_t>(percent / 25);
+        case BucketDistribution::Distant: return percent < 10 ? 0 : (percent < 30 ? 2 : 4);
+    }
+    return 0;
+}
+
+// World of Position + Velocity entities updated at rates set by UpdateBucket tags
+class BucketEntityWorld {
+public:
+    using Bucket0 = SubzeroECS::UpdateBucket<0>;
+    using Bucket1 = SubzeroECS::UpdateBucket<1>;
+    using Bucket2 = SubzeroECS::UpdateBucket<2>;
+    using Bucket3 = SubzeroECS::UpdateBucket<3>;
+    using Bucket4 = SubzeroECS::UpdateBucket<4>;
+
+    BucketEntityWorld()
+        : collections_(world_)
+        , physicsSystem_(world_)
+    {}
+
+    void addEntity(float x, float y, float vx, float vy, size_t bucketLevel) {
+        SubzeroECS::Entity entity = world_.create(Position{x, y}, Velocity{vx, vy});
+        switch (bucketLevel) {
+            case 0: world_.add(entity.id(), Bucket0{}); break;
+            case 1: world_.add(entity.id(), Bucket1{}); break;
+            case 2: world_.add(entity.id(), Bucket2{}); break;
+            case 3: world_.add(entity.id(), Bucket3{}); break;
+            default: world_.add(entity.id(), Bucket4{}); break;
+        }
+    }
+
+    void updateAll(float deltaTime) {
+        physicsSystem_.deltaTime = deltaTime;
+        physicsSystem_.updateBuckets();
+    }
+
+private:
+    SubzeroECS::World world_;
+    SubzeroECS::Collection<Position, Velocity, Bucket0, Bucket1, Bucket2, Bucket3, Bucket4> collections_;
+    PhysicsBucketSystem physicsSystem_;
+};
+
 } // namespace ECS_Pattern
@@ -48,6 +48,40 @@ static void BM_UpdateEntities(benchmark::State& state, DistributionPattern patte
     state.SetItemsProcessed(state.iterations() * entityCount);
 }
 
+// Counting the 3-way Health/Rotation/Scale intersection of a fragmented ECS world
+template<typename WorldType>
+static void BM_CountEntities(benchmark::State& state, bool iterate) {
+    const int64_t entityCount = state.range(0);
+
+    WorldType world;
+    RandomGenerator rng;
+    for (int64_t i = 0; i < entityCount; ++i) {
+        world.addEntity(rng.next(), rng.next(), rng.next(), rng.next(), getEntityType(i, DistributionPattern::Fragmented));
+    }
+    for (auto _ : state) {
+        size_t count = iterate ? world.countMediumIterated() : world.countMedium();
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * entityCount);
+}
+
+// Physics update with entities spread over update-rate buckets, items are the entities simulated per frame
+static void BM_UpdateBuckets(benchmark::State& state, ECS_Pattern::BucketDistribution distribution) {
+    const int64_t entityCount = state.range(0);
+    const float deltaTime = 1.0f / 60.0f;
+
+    ECS_Pattern::BucketEntityWorld world;
+    RandomGenerator rng;
+    for (int64_t i = 0; i < entityCount; ++i) {
+        world.addEntity(rng.next(), rng.next(), rng.next(), rng.next(), ECS_Pattern::getBucketLevel(i, distribution));
+    }
+    for (auto _ : state) {
+        world.updateAll(deltaTime);
+        benchmark::DoNotOptimize(world);
+    }
+    state.SetItemsProcessed(state.iterations() * entityCount);
+}
+
 // ============================================================================
 // Benchmark Registration - Using BENCHMARK_CAPTURE for both type and pattern
 // ============================================================================
@@ -55,20 +89,35 @@ static void BM_UpdateEntities(benchmark::State& state, DistributionPattern patte
 #define REGISTER_SIZE_BENCHMARKS(Size) \
     /* Size: Creation - Coherent */ \
     BENCHMARK_CAPTURE(BM_CreateEntities<ECS_Pattern::EntityWorld>, ECS_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_CreateEntities<ECS_Pattern::StaticEntityWorld>, ECS_Static_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond); \
     BENCHMARK_CAPTURE(BM_CreateEntities<OOP_Pattern::EntityManager>, OOP_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond); \
     BENCHMARK_CAPTURE(BM_CreateEntities<DOD_Pattern::EntityData>, DOD_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond); \
     /* Size: Creation - Fragmented */ \
     BENCHMARK_CAPTURE(BM_CreateEntities<ECS_Pattern::EntityWorld>, ECS_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_CreateEntities<ECS_Pattern::StaticEntityWorld>, ECS_Static_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond); \
     BENCHMARK_CAPTURE(BM_CreateEntities<OOP_Pattern::EntityManager>, OOP_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond); \
     BENCHMARK_CAPTURE(BM_CreateEntities<DOD_Pattern::EntityData>, DOD_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond); \
     /* Size: Update - Coherent */ \
     BENCHMARK_CAPTURE(BM_UpdateEntities<ECS_Pattern::EntityWorld>, ECS_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_UpdateEntities<ECS_Pattern::StaticEntityWorld>, ECS_Static_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_UpdateEntities<ECS_Pattern::EachEntityWorld>, ECS_Each_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_UpdateEntities<ECS_Pattern::ParallelEntityWorld>, ECS_Par_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond)->UseRealTime(); \
     BENCHMARK_CAPTURE(BM_UpdateEntities<OOP_Pattern::EntityManager>, OOP_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond); \
     BENCHMARK_CAPTURE(BM_UpdateEntities<DOD_Pattern::EntityData>, DOD_Coherent, DistributionPattern::Coherent)->Arg(Size)->Unit(benchmark::kMicrosecond); \
     /* Size: Update - Fragmented */ \
     BENCHMARK_CAPTURE(BM_UpdateEntities<ECS_Pattern::EntityWorld>, ECS_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_UpdateEntities<ECS_Pattern::StaticEntityWorld>, ECS_Static_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_UpdateEntities<ECS_Pattern::EachEntityWorld>, ECS_Each_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_UpdateEntities<ECS_Pattern::ParallelEntityWorld>, ECS_Par_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond)->UseRealTime(); \
     BENCHMARK_CAPTURE(BM_UpdateEntities<OOP_Pattern::EntityManager>, OOP_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond); \
-    BENCHMARK_CAPTURE(BM_UpdateEntities<DOD_Pattern::EntityData>, DOD_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_UpdateEntities<DOD_Pattern::EntityData>, DOD_Fragmented, DistributionPattern::Fragmented)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    /* Size: Count 3-way intersection - Fragmented */ \
+    BENCHMARK_CAPTURE(BM_CountEntities<ECS_Pattern::EntityWorld>, ECS_Count_Fragmented, false)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_CountEntities<ECS_Pattern::EntityWorld>, ECS_Iterate_Fragmented, true)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    /* Size: Update-rate buckets */ \
+    BENCHMARK_CAPTURE(BM_UpdateBuckets, ECS_Buckets_EveryFrame, ECS_Pattern::BucketDistribution::EveryFrame)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_UpdateBuckets, ECS_Buckets_Mixed, ECS_Pattern::BucketDistribution::Mixed)->Arg(Size)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BM_UpdateBuckets, ECS_Buckets_Distant, ECS_Pattern::BucketDistribution::Distant)->Arg(Size)->Unit(benchmark::kMicrosecond);
 
 // Register benchmarks for each size
 REGISTER_SIZE_BENCHMARKS(10)
@@ -2,6 +2,7 @@
 
 #include "SubzeroECS/World.hpp"
 #include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/FusedSystem.hpp"
 #include "Components.hpp"
 #include "ECS_Systems.hpp"
 #include <memory>
@@ -29,6 +30,7 @@ public:
         gravitySystem = std::make_unique<GravitySystem>(*world);
         movementSystem = std::make_unique<MovementSystem>(*world);
         boundarySystem = std::make_unique<BoundaryCollisionSystem>(*world);
+        physicsSystem = std::make_unique<PhysicsSystem>(*world, *gravitySystem, *movementSystem, *boundarySystem);
         collisionSystem = std::make_unique<BallCollisionSystem>(*world);
         
         gravitySystem->gravity = config.gravity;
@@ -52,14 +54,8 @@ public:
     }
 
     void clear() {
-        // Reinitialize to clear all entities
-        gravitySystem.reset();
-        movementSystem.reset();
-        boundarySystem.reset();
-        collisionSystem.reset();
-        collections.reset();
-        world.reset();
-        initialize();
+        // Empty the world keeping its collections, systems and allocations
+        world->clear();
     }
 
     void update(float deltaTime) {
@@ -67,9 +63,8 @@ public:
         movementSystem->deltaTime = deltaTime;
         collisionSystem->deltaTime = deltaTime;
         
-        gravitySystem->update();
-        movementSystem->update();
-        boundarySystem->update();
+        // Gravity, movement and boundary collision in a single pass over the balls
+        physicsSystem->update();
         collisionSystem->update();
     }
 
@@ -78,11 +73,14 @@ public:
     const SubzeroECS::World& getWorld() const { return *world; }
 
 private:
+    using PhysicsSystem = SubzeroECS::FusedSystem<GravitySystem, MovementSystem, BoundaryCollisionSystem>;
+
     std::unique_ptr<SubzeroECS::World> world;
     std::unique_ptr<SubzeroECS::Collection<Position, Velocity, Radius, Mass, Color>> collections;
     std::unique_ptr<GravitySystem> gravitySystem;
     std::unique_ptr<MovementSystem> movementSystem;
     std::unique_ptr<BoundaryCollisionSystem> boundarySystem;
+    std::unique_ptr<PhysicsSystem> physicsSystem;
     std::unique_ptr<BallCollisionSystem> collisionSystem;
 };
 
@@ -0,0 +1,319 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility> //< std::move
+#include <vector>
+
+#include "Collection.hpp"
+#include "EntityId.hpp"
+#include "View.hpp"
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+/** Apache Arrow C Data Interface ABI, @see https://arrow.apache.org/docs/format/CDataInterface.html */
+extern "C" {
+
+struct ArrowSchema {
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+} // extern "C"
+
+#endif // ARROW_C_DATA_INTERFACE
+
+namespace SubzeroECS
+{
+	/** Describes a component member as a named Arrow struct child, @see ArrowFields */
+	template< typename Class, typename Member >
+	struct ArrowField
+	{
+		const char* name; ///< Child field name
+		Member Class::* member; ///< Member pointer the child values are read from
+	};
+
+	/** Describes how exportArrow() lays out a component type
+	 * Specialise with a `name` for the column and `members` to export a struct of children e.g.
+	 * @code
+	 * template<> struct SubzeroECS::ArrowFields<Position>
+	 * {
+	 *     static constexpr const char* name = "position";
+	 *     static constexpr auto members = std::make_tuple( ArrowField{ "x", &Position::x }, ArrowField{ "y", &Position::y } );
+	 * };
+	 * @endcode
+	 * Arithmetic components are exported as primitive columns and other trivially copyable components without
+	 * members as fixed-size binary, both zero-copy from a contiguous column.
+	 */
+	template< typename Component >
+	struct ArrowFields
+	{};
+
+	namespace Detail
+	{
+		/** Arrow format string of a primitive type, bool is exported as uint8 as Arrow booleans are bit-packed */
+		template< typename T >
+		constexpr const char* arrowFormat() noexcept
+		{
+			if constexpr ( std::is_same_v<T, float> ) return "f";
+			else if constexpr ( std::is_same_v<T, double> ) return "g";
+			else if constexpr ( std::is_same_v<T, bool> ) return "C";
+			else if constexpr ( std::is_integral_v<T> && std::is_signed_v<T> )
+				return sizeof(T) == 1U ? "c" : sizeof(T) == 2U ? "s" : sizeof(T) == 4U ? "i" : "l";
+			else if constexpr ( std::is_integral_v<T> )
+				return sizeof(T) == 1U ? "C" : sizeof(T) == 2U ? "S" : sizeof(T) == 4U ? "I" : "L";
+			else
+				return nullptr;
+		}
+
+		template< typename Component >
+		concept ArrowMembers = requires { ArrowFields<Component>::members; };
+
+		template< typename Component >
+		std::string arrowName( std::size_t index )
+		{
+			if constexpr ( requires { ArrowFields<Component>::name; } )
+				return ArrowFields<Component>::name;
+			else
+				return "component" + std::to_string(index);
+		}
+
+		/** Owner of an exported array node, its copied buffers and its children */
+		struct ArrowArrayNode
+		{
+			std::vector< std::unique_ptr<std::byte[]> > owned; ///< Buffers gathered for the export
+			std::vector<const void*> buffers; ///< ArrowArray::buffers
+			std::vector<ArrowArray> children; ///< Child arrays
+			std::vector<ArrowArray*> childPointers; ///< ArrowArray::children
+		};
+
+		/** Owner of an exported schema node and its children */
+		struct ArrowSchemaNode
+		{
+			std::string format; ///< ArrowSchema::format
+			std::string name; ///< ArrowSchema::name
+			std::vector<ArrowSchema> children; ///< Child schemas
+			std::vector<ArrowSchema*> childPointers; ///< ArrowSchema::children
+		};
+
+		inline void releaseArrowArray( ArrowArray* array )
+		{
+			auto* node = static_cast<ArrowArrayNode*>( array->private_data );
+			for ( ArrowArray& child : node->children )
+			{
+				if ( child.release != nullptr ) //< Children moved out by the consumer are already released
+					child.release( &child );
+			}
+			delete node;
+			array->release = nullptr;
+		}
+
+		inline void releaseArrowSchema( ArrowSchema* schema )
+		{
+			auto* node = static_cast<ArrowSchemaNode*>( schema->private_data );
+			for ( ArrowSchema& child : node->children )
+			{
+				if ( child.release != nullptr )
+					child.release( &child );
+			}
+			delete node;
+			schema->release = nullptr;
+		}
+
+		/** Initialise an array node
+		 * @param buffers  ArrowArray::buffers e.g. { nullptr } for a struct array or { nullptr, values } for a
+		 *                 primitive array, both without a validity bitmap
+		 */
+		inline ArrowArrayNode& initArrowArray( ArrowArray* array, std::size_t length, std::size_t childCount, std::vector<const void*> buffers )
+		{
+			auto* node = new ArrowArrayNode();
+			node->buffers = std::move(buffers);
+			node->children.resize( childCount );
+			for ( ArrowArray& child : node->children )
+				node->childPointers.push_back( &child );
+
+			*array = ArrowArray{ static_cast<int64_t>(length), 0, 0
+				, static_cast<int64_t>(node->buffers.size()), static_cast<int64_t>(childCount)
+				, node->buffers.data(), node->childPointers.data(), nullptr, &releaseArrowArray, node };
+			return *node;
+		}
+
+		inline ArrowSchemaNode& initArrowSchema( ArrowSchema* schema, std::string format, std::string name, std::size_t childCount )
+		{
+			auto* node = new ArrowSchemaNode{ std::move(format), std::move(name), {}, {} };
+			node->children.resize( childCount );
+			for ( ArrowSchema& child : node->children )
+				node->childPointers.push_back( &child );
+
+			*schema = ArrowSchema{ node->format.c_str(), node->name.c_str(), nullptr, 0
+				, static_cast<int64_t>(childCount), node->childPointers.data(), nullptr, &releaseArrowSchema, node };
+			return *node;
+		}
+
+		/** Export a leaf column of fixed width values, zero-copy from @p contiguous else gathered through @p at */
+		template< typename T, typename At >
+		void exportArrowValues( ArrowArray* array, std::size_t length, const T* contiguous, At&& at )
+		{
+			if ( contiguous != nullptr )
+			{
+				initArrowArray( array, length, 0U, { nullptr, contiguous } );
+				return;
+			}
+
+			std::unique_ptr<std::byte[]> values( new std::byte[ length * sizeof(T) + 1U ] );
+			for ( std::size_t i = 0U; i < length; ++i )
+			{
+				const T& value = at(i);
+				std::memcpy( values.get() + i * sizeof(T), &value, sizeof(T) );
+			}
+			ArrowArrayNode& node = initArrowArray( array, length, 0U, { nullptr, values.get() } );
+			node.owned.push_back( std::move(values) );
+		}
+
+		template< typename Component, typename At >
+		void exportArrowColumn( ArrowArray* array, ArrowSchema* schema, std::string name, std::size_t length, const Component* contiguous, At&& at );
+
+		template< typename Component, typename At, typename... Fields, std::size_t... Is >
+		void exportArrowMembers( ArrowArray* array, ArrowSchema* schema, std::string name, std::size_t length, At& at
+			, const std::tuple<Fields...>& fields, std::index_sequence<Is...> )
+		{
+			ArrowArrayNode& arrayNode = initArrowArray( array, length, sizeof...(Fields), { nullptr } );
+			ArrowSchemaNode& schemaNode = initArrowSchema( schema, "+s", std::move(name), sizeof...(Fields) );
+			(exportArrowColumn( &arrayNode.children[Is], &schemaNode.children[Is], std::get<Is>(fields).name, length
+				, static_cast< const std::remove_cvref_t<decltype(at(0U).*(std::get<Is>(fields).member))>* >(nullptr)
+				, [&]( std::size_t i ) -> const auto& { return at(i).*(std::get<Is>(fields).member); } ), ...);
+		}
+
+		/** Export a component column as a primitive, struct (@see ArrowFields) or fixed-size binary array
+		 * @param contiguous  Column data when stored contiguously for a zero-copy export, else nullptr
+		 * @param at          Callable returning the i-th component for a gathered export
+		 */
+		template< typename Component, typename At >
+		void exportArrowColumn( ArrowArray* array, ArrowSchema* schema, std::string name, std::size_t length, const Component* contiguous, At&& at )
+		{
+			if constexpr ( ArrowMembers<Component> )
+			{
+				// Members of an array of structs are strided so struct children are always gathered
+				constexpr auto& fields = ArrowFields<Component>::members;
+				exportArrowMembers<Component>( array, schema, std::move(name), length, at, fields
+					, std::make_index_sequence< std::tuple_size_v< std::remove_cvref_t<decltype(fields)> > >{} );
+			}
+			else if constexpr ( arrowFormat<Component>() != nullptr )
+			{
+				initArrowSchema( schema, arrowFormat<Component>(), std::move(name), 0U );
+				exportArrowValues( array, length, contiguous, at );
+			}
+			else
+			{
+				static_assert( std::is_trivially_copyable_v<Component>, "Component must be arithmetic, trivially copyable or describe ArrowFields<Component>::members" );
+				initArrowSchema( schema, "w:" + std::to_string(sizeof(Component)), std::move(name), 0U );
+				exportArrowValues( array, length, contiguous, at );
+			}
+		}
+
+		inline void exportArrowIds( ArrowArray* array, ArrowSchema* schema, std::size_t length, const EntityId* contiguous )
+		{
+			static_assert( sizeof(EntityId) == sizeof(std::uint32_t) && std::is_standard_layout_v<EntityId> );
+			initArrowSchema( schema, "I", "id", 0U );
+			initArrowArray( array, length, 0U, { nullptr, contiguous } );
+		}
+
+	} //END: Detail
+
+	/** Export a collection as an Arrow struct array of an `id` uint32 column and the component column
+	 * Ids and a contiguous (VectorStorage) column of arithmetic or trivially copyable components are exported
+	 * zero-copy, struct members (@see ArrowFields) and paged columns are gathered into buffers owned by the export.
+	 * @param[out] array   Released by the consumer with array->release(array)
+	 * @param[out] schema  Released by the consumer with schema->release(schema)
+	 * @warning Zero-copy buffers are invalidated when entities are added to or removed from the collection
+	 */
+	template< typename Component >
+	void exportArrow( Collection<Component>& collection, ArrowArray* array, ArrowSchema* schema )
+	{
+		auto& components = collection.components();
+		const Component* contiguous = nullptr;
+		if constexpr ( std::is_same_v< std::remove_cvref_t<decltype(components)>, std::vector<Component> > )
+			contiguous = components.data();
+
+		const std::size_t length = collection.size();
+		Detail::ArrowArrayNode& arrayNode = Detail::initArrowArray( array, length, 2U, { nullptr } );
+		Detail::ArrowSchemaNode& schemaNode = Detail::initArrowSchema( schema, "+s", "", 2U );
+		Detail::exportArrowIds( &arrayNode.children[0], &schemaNode.children[0], length, collection.ids().data() );
+		Detail::exportArrowColumn( &arrayNode.children[1], &schemaNode.children[1], Detail::arrowName<Component>(0U), length
+			, contiguous, [&]( std::size_t i ) -> const Component& { return components[i]; } );
+	}
+
+	/** Export the entities of a view as an Arrow struct array of an `id` uint32 column and a column per component
+	 * A single component view exports its collection, @see exportArrow(Collection&). Intersected views gather
+	 * the matching rows into buffers owned by the export.
+	 */
+	template< typename... Components >
+	void exportArrow( View<Components...>& view, ArrowArray* array, ArrowSchema* schema )
+	{
+		if constexpr ( sizeof...(Components) == 1U )
+		{
+			exportArrow( view.template getCollection<Components...>(), array, schema );
+		}
+		else
+		{
+			std::vector<EntityId> ids;
+			std::tuple< std::vector<const Components*>... > rows;
+			view.template eachAs< std::tuple<EntityId, const Components&...> >( [&]( EntityId entityId, const Components&... components )
+			{
+				ids.push_back( entityId );
+				(std::get< std::vector<const Components*> >(rows).push_back( &components ), ...);
+			});
+
+			const std::size_t length = ids.size();
+			Detail::ArrowArrayNode& arrayNode = Detail::initArrowArray( array, length, 1U + sizeof...(Components), { nullptr } );
+			Detail::ArrowSchemaNode& schemaNode = Detail::initArrowSchema( schema, "+s", "", 1U + sizeof...(Components) );
+			Detail::exportArrowValues( &arrayNode.children[0], length, static_cast<const EntityId*>(nullptr)
+				, [&]( std::size_t i ) -> const EntityId& { return ids[i]; } );
+			Detail::initArrowSchema( &schemaNode.children[0], "I", "id", 0U );
+
+			std::size_t column = 1U;
+			((Detail::exportArrowColumn( &arrayNode.children[column], &schemaNode.children[column]
+				, Detail::arrowName<Components>(column - 1U), length, static_cast<const Components*>(nullptr)
+				, [&]( std::size_t i ) -> const Components& { return *std::get< std::vector<const Components*> >(rows)[i]; } ), ++column), ...);
+		}
+	}
+
+} //END: SubzeroECS
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility> //< std::index_sequence
+
+#include "System.hpp"
+#include "View.hpp"
+
+namespace SubzeroECS
+{
+	/** Tag component assigning an entity to an update-rate bucket of a BucketedSystem
+	 * Entities in bucket Level are processed every 2^Level frames, e.g. UpdateBucket<0> every frame,
+	 * UpdateBucket<2> every 4th frame. Move an entity between buckets by removing and adding the tag.
+	 */
+	template< std::size_t Level >
+	struct UpdateBucket {};
+
+	/** System processing entities at a rate chosen per entity by an UpdateBucket tag (LOD scheduling)
+	 *
+	 * Each bucket is a View<Components..., UpdateBucket<Level>> so a frame only intersects the buckets due.
+	 * Bucket phases are staggered so that besides bucket 0 at most one bucket is due per frame: bucket
+	 * Level >= 1 is due when frame % 2^Level == 2^(Level-1). Frame cost is then the every-frame entities
+	 * plus a single bucket rather than spiking when all rates coincide.
+	 *
+	 * processEntity may take the components (and EntityId) it accesses, or a generic iterator parameter
+	 * e.g. `void processEntity(auto iEntity)`, as the bucket views differ in type.
+	 *
+	 * @tparam Derived     Derived system type implementing processEntity
+	 * @tparam Levels      Number of buckets, UpdateBucket<0> to UpdateBucket<Levels-1>
+	 * @tparam Components  Components processed by the system
+	 * @remark update() processes the buckets due on the next frame, so systems driven through ISystem e.g. by
+	 *         WorldGroup keep their schedule. Entities without an UpdateBucket tag are not processed.
+	 * @warning processEntity() is not bucketed when called by a FusedSystem, so do not fuse a BucketedSystem
+	 */
+	template< typename Derived, std::size_t Levels, typename... Components >
+	class BucketedSystem : public System<Derived, Components...>
+	{
+	public:
+		static_assert( Levels > 0U && Levels <= 64U, "BucketedSystem supports 1 to 64 bucket levels" );
+
+		using SystemType = System<Derived, Components...>;
+
+		BucketedSystem( CollectionRegistry& registry )
+			: SystemType( registry )
+			, buckets_( makeBuckets( registry, std::make_index_sequence<Levels>{} ) )
+		{}
+
+		template< typename... WorldComponents >
+		BucketedSystem( StaticWorld<WorldComponents...>& world )
+			: SystemType( world )
+			, buckets_( makeBuckets( world, std::make_index_sequence<Levels>{} ) )
+		{}
+
+		/** True if entities of bucket @p level are processed on @p frame */
+		static constexpr bool isDue( std::size_t level, std::uint64_t frame ) noexcept
+		{
+			if ( level == 0U )
+				return true;
+			const std::uint64_t period = std::uint64_t{1U} << level;
+			return (frame & (period - 1U)) == (period >> 1U);
+		}
+
+		/** Process the entities of every bucket due on @p frame */
+		void updateBuckets( std::uint64_t frame )
+		{
+			updateBucketsImpl( frame, std::make_index_sequence<Levels>{} );
+		}
+
+		/** Process the entities of every bucket due on the next frame of an internal counter */
+		void updateBuckets()
+		{
+			updateBuckets( frame_++ );
+		}
+
+		/** Process the entities of every bucket due on the next frame, @see updateBuckets() */
+		void update() override
+		{
+			updateBuckets();
+		}
+
+		/// Slices would process every entity of the view regardless of bucket
+		bool updateSlice( const SliceBudget& budget ) = delete;
+
+		/** Frames between updates of the bucket being processed, e.g. to scale a time step in processEntity */
+		std::uint64_t bucketPeriod() const noexcept
+		{ return bucketPeriod_; }
+
+	private:
+		template< std::size_t Level >
+		using BucketView = View< Components..., UpdateBucket<Level> >;
+
+		template< typename WorldType, std::size_t... Levels_ >
+		static std::tuple< BucketView<Levels_>... > makeBuckets( WorldType& world, std::index_sequence<Levels_...> )
+		{
+			return std::tuple< BucketView<Levels_>... >( BucketView<Levels_>( world )... );
+		}
+
+		template< std::size_t... Levels_ >
+		void updateBucketsImpl( std::uint64_t frame, std::index_sequence<Levels_...> )
+		{
+			((isDue( Levels_, frame ) ? updateBucket( std::get<Levels_>(buckets_), std::uint64_t{1U} << Levels_ ) : void()), ...);
+		}
+
+		template< typename BucketViewType >
+		void updateBucket( BucketViewType& bucket, std::uint64_t period )
+		{
+			bucketPeriod_ = period;
+			Derived* derived = static_cast<Derived*>(this);
+			using BucketIterator = typename BucketViewType::Iterator;
+			if constexpr ( requires( Derived& system, BucketIterator iEntity ) { system.processEntity(iEntity); } )
+			{
+				const auto iEnd = bucket.end();
+				for ( auto iEntity = bucket.begin(); iEntity != iEnd; ++iEntity )
+				{
+					derived->processEntity( iEntity );
+				}
+			}
+			else
+			{
+				using Arguments = typename Utility::CallableTraits<decltype(&Derived::processEntity)>::Arguments;
+				bucket.template eachAs<Arguments>( [derived]( auto&&... args )
+				{
+					derived->processEntity( std::forward<decltype(args)>(args)... );
+				});
+			}
+		}
+
+	private:
+		template< std::size_t... Levels_ >
+		static auto bucketsType( std::index_sequence<Levels_...> ) -> std::tuple< BucketView<Levels_>... >;
+
+		decltype( bucketsType( std::make_index_sequence<Levels>{} ) ) buckets_; ///< View of each bucket
+		std::uint64_t frame_ = 0U; ///< Frame counter for updateBuckets()
+		std::uint64_t bucketPeriod_ = 1U; ///< Period of the bucket being processed
+	};
+
+} //END: SubzeroECS
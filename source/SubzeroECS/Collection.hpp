@@ -1,10 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <map>
+#include <span>
+#include <tuple>
 #include <vector>
 
 #include "CollectionRegistry.hpp"
+#include "ComponentStorage.hpp"
 #include "EntityId.hpp"
+#include "Group.hpp"
+#include "SearchIndex.hpp"
+#include "Utility/DynamicBitset.hpp"
+#include "Utility/Prefetch.hpp"
+#include "Utility/Relocate.hpp"
 
 namespace SubzeroECS {
 
@@ -17,20 +27,34 @@ namespace SubzeroECS {
 	public: 
 		using Component = TComponent;
 
-		using EntityIdVector = std::vector<EntityId>;
-		using ComponentVector = std::vector<Component>;
+		using EntityIdVector = typename ComponentStorage<Component>::template IdContainer<EntityId>; ///< @see ComponentStorage
+		using ComponentVector = typename ComponentStorage<Component>::template Container<Component>; ///< @see ComponentStorage
 		using Iterator = typename EntityIdVector::iterator;
 
+		static constexpr bool HasMembership = ComponentMembership<Component>::value; ///< @see ComponentMembership
+		static constexpr bool HasSearchIndex = ComponentSearchIndex<Component>::value; ///< @see ComponentSearchIndex
+		static constexpr bool IsTransient = ComponentTransient<Component>::value; ///< @see ComponentTransient
+		static constexpr bool IsRelocatable = ComponentRelocatable<Component>::value
+			&& std::is_same_v<ComponentVector, std::vector<Component>>; ///< Column shifted with memmove, @see ComponentRelocatable
+		static constexpr bool HasStableComponents = requires( ComponentVector& vector, std::span<const size_t> indices )
+			{ vector.eraseMany( indices ); }; ///< Column never moves components between entities, @see IndirectStorage
+
 	public:
+		/** Construct a collection that is not attached to any registry e.g. owned by StaticWorld */
+		Collection()
+			: registry_(nullptr)
+		{}
+
 		Collection( CollectionRegistry& registry )
-			: registry_(registry)
+			: registry_(&registry)
 		{ 
-			registry_.registerCollection(this); 
+			registry_->registerCollection(this); 
 		}
 
 		~Collection()
 		{ 
-			registry_.unregisterCollection(this);
+			if ( registry_ != nullptr )
+				registry_->unregisterCollection(this);
 		}
 
 		Component* create(EntityId entityId, Component&& component) noexcept(false)
@@ -43,13 +67,241 @@ namespace SubzeroECS {
 
 			const size_t index = std::distance( ids_.begin(), iFind );
 			ids_.insert( iFind, entityId );	
-			components_.insert( components_.begin() + index, std::move(component) );
+			if constexpr ( IsRelocatable )
+			{
+				components_.push_back( std::move(component) );
+				Utility::relocateToFront( components_.data() + index, components_.data() + components_.size() );
+			}
+			else
+			{
+				components_.insert( components_.begin() + index, std::move(component) );
+			}
+			if constexpr ( HasMembership )
+				membership_.set( entityId.value );
+			++version_;
 			return &components_.at( index );
 		}
 
-		bool has(EntityId entityId)
+		/** Add the components of many entities with a single bulk merge
+		 * Ids above all existing ids, e.g. newly created entities, are appended, otherwise the columns are merged
+		 * into new storage in one pass. Either way it avoids the per-entity shifting of repeated create().
+		 * @param entityIds   Ids sorted ascending without duplicates
+		 * @param components  Components moved from, where components[i] belongs to entityIds[i]
+		 * @throw std::invalid_argument if an entity already has this component, the collection is unchanged
+		 */
+		void createMany( std::span<const EntityId> entityIds, std::span<Component> components ) noexcept(false)
+		{
+			assert( entityIds.size() == components.size() );
+			assert( std::is_sorted( entityIds.begin(), entityIds.end() ) );
+			if ( entityIds.empty() )
+				return;
+
+			if ( ids_.empty() || ids_.back() < entityIds.front() )
+			{
+				for ( size_t i = 0U; i < entityIds.size(); ++i )
+				{
+					ids_.push_back( entityIds[i] );
+					components_.push_back( std::move(components[i]) );
+				}
+			}
+			else
+			{
+				// Check for duplicates before anything is moved
+				std::vector<size_t> positions; //< Index each id is inserted before, kept for stable columns
+				if constexpr ( HasStableComponents )
+					positions.reserve( entityIds.size() );
+				size_t existing = 0U;
+				for ( const EntityId entityId : entityIds )
+				{
+					existing = static_cast<size_t>( std::lower_bound( ids_.begin() + existing, ids_.end(), entityId ) - ids_.begin() );
+					if ( existing < ids_.size() && ids_[existing] == entityId )
+						throw std::invalid_argument( "EntityId already has this component type for call to Collection::createMany()" );
+					if constexpr ( HasStableComponents )
+						positions.push_back( existing );
+				}
+
+				if constexpr ( HasStableComponents )
+				{
+					// Merge the ids and insert the new components leaving the existing ones in place
+					EntityIdVector ids;
+					ids.reserve( ids_.size() + entityIds.size() );
+					existing = 0U;
+					for ( size_t i = 0U; i < entityIds.size(); ++i )
+					{
+						for ( ; existing < positions[i]; ++existing )
+							ids.push_back( ids_[existing] );
+						ids.push_back( entityIds[i] );
+					}
+					ids.insert( ids.end(), ids_.begin() + existing, ids_.end() );
+					components_.insertMany( positions, components );
+					ids_ = std::move(ids);
+				}
+				else
+				{
+					EntityIdVector ids;
+					ComponentVector merged;
+					if constexpr ( requires { merged.reserve( 0U ); } )
+					{
+						ids.reserve( ids_.size() + entityIds.size() );
+						merged.reserve( ids_.size() + entityIds.size() );
+					}
+
+					existing = 0U;
+					for ( size_t i = 0U; i < entityIds.size(); ++i )
+					{
+						for ( ; existing < ids_.size() && ids_[existing] < entityIds[i]; ++existing )
+						{
+							ids.push_back( ids_[existing] );
+							merged.push_back( std::move(components_[existing]) );
+						}
+						ids.push_back( entityIds[i] );
+						merged.push_back( std::move(components[i]) );
+					}
+					for ( ; existing < ids_.size(); ++existing )
+					{
+						ids.push_back( ids_[existing] );
+						merged.push_back( std::move(components_[existing]) );
+					}
+					ids_ = std::move(ids);
+					components_ = std::move(merged);
+				}
+			}
+
+			if constexpr ( HasMembership )
+			{
+				for ( const EntityId entityId : entityIds )
+					membership_.set( entityId.value );
+			}
+			version_ += entityIds.size();
+		}
+
+		/** Add copies of a component for a block of new entities with a single reserve and fill
+		 * @param entities  Ids above every id in the collection, @see World::createRange()
+		 * @return Index in components() of the component of the first entity
+		 * @throw std::invalid_argument if an id is not above the existing ids
+		 */
+		size_t createRange( EntityRange entities, const Component& component ) noexcept(false)
+		{
+			const size_t start = ids_.size();
+			if ( entities.count == 0U )
+				return start;
+			if ( !ids_.empty() && !(ids_.back() < entities.first) )
+				throw std::invalid_argument( "EntityId range not above the existing ids for call to Collection::createRange()" );
+
+			if constexpr ( requires { components_.reserve( 0U ); } )
+			{
+				ids_.reserve( start + entities.count );
+				components_.reserve( start + entities.count );
+			}
+			for ( size_t i = 0U; i < entities.count; ++i )
+			{
+				ids_.push_back( entities[i] );
+				components_.push_back( component );
+			}
+			if constexpr ( HasMembership )
+			{
+				for ( size_t i = 0U; i < entities.count; ++i )
+					membership_.set( entities[i].value );
+			}
+			version_ += entities.count;
+			return start;
+		}
+
+		/** Remove the component of an entity
+		@return false if the entity did not have this component
+		*/
+		bool remove(EntityId entityId)
 		{
 			auto iFind = std::lower_bound( ids_.begin(), ids_.end(), entityId );
+			if ( iFind == ids_.end() || *iFind != entityId )
+				return false;
+
+			const size_t index = std::distance( ids_.begin(), iFind );
+			ids_.erase( iFind );
+			if constexpr ( IsRelocatable )
+			{
+				Utility::relocateToBack( components_.data() + index, components_.data() + components_.size() );
+				components_.pop_back();
+			}
+			else
+			{
+				components_.erase( components_.begin() + index );
+			}
+			if constexpr ( HasMembership )
+				membership_.reset( entityId.value );
+			++version_;
+			return true;
+		}
+
+		/** Remove the components of many entities in a single compacting pass
+		 * Cheaper than repeated remove() which shifts the tail of the collection once per entity
+		 * @param entityIds  Ids sorted ascending, ids without this component are ignored
+		 * @return Number of components removed
+		 */
+		size_t removeMany( std::span<const EntityId> entityIds )
+		{
+			assert( std::is_sorted( entityIds.begin(), entityIds.end() ) );
+			const size_t size = ids_.size();
+			size_t read = 0U;
+			size_t write = 0U;
+			std::vector<size_t> erased; //< Indices of the removed components, kept for stable columns
+			for ( const EntityId entityId : entityIds )
+			{
+				// Gallop over kept entities to the next removed one and shift them down
+				const size_t next = static_cast<size_t>( std::lower_bound( ids_.begin() + read, ids_.end(), entityId ) - ids_.begin() );
+				if ( next == size || ids_[next] != entityId )
+					continue;
+				if ( write != read )
+				{
+					std::move( ids_.begin() + read, ids_.begin() + next, ids_.begin() + write );
+					if constexpr ( !HasStableComponents )
+						std::move( components_.begin() + read, components_.begin() + next, components_.begin() + write );
+				}
+				if constexpr ( HasStableComponents )
+					erased.push_back( next );
+				write += next - read;
+				read = next + 1U;
+				if constexpr ( HasMembership )
+					membership_.reset( entityId.value );
+			}
+
+			const size_t removed = read - write;
+			if ( removed == 0U )
+				return 0U;
+
+			std::move( ids_.begin() + read, ids_.end(), ids_.begin() + write );
+			ids_.resize( size - removed );
+			if constexpr ( HasStableComponents )
+			{
+				components_.eraseMany( erased );
+			}
+			else
+			{
+				std::move( components_.begin() + read, components_.end(), components_.begin() + write );
+				for ( size_t i = 0U; i < removed; ++i )
+					components_.pop_back();
+			}
+			version_ += removed;
+			return removed;
+		}
+
+		/** Remove every component retaining the allocated capacity
+		 * O(1) for trivially destructible components in the default storage, besides clearing the membership bitset
+		 */
+		void clear() noexcept
+		{
+			ids_.clear();
+			components_.clear();
+			if constexpr ( HasMembership )
+				membership_.clear();
+			++version_;
+		}
+
+		bool has(EntityId entityId)
+		{
+			if constexpr ( HasMembership )
+				return membership_.test( entityId.value );
+			auto iFind = lowerBound( entityId );
 			return iFind != ids_.end() && *iFind == entityId;
 		}
 
@@ -58,7 +310,12 @@ namespace SubzeroECS {
 		*/
 		Component* find(EntityId entityId) noexcept(true)
 		{
-			const auto iFind = std::lower_bound( ids_.begin(), ids_.end(), entityId );
+			if constexpr ( HasMembership )
+			{
+				if ( !membership_.test( entityId.value ) )
+					return nullptr;
+			}
+			const auto iFind = lowerBound( entityId );
 			return (iFind != ids_.end() && *iFind == entityId)
 				? &at(iFind)
 				: nullptr;
@@ -69,12 +326,39 @@ namespace SubzeroECS {
 		*/
 		Component& get(EntityId entityId) noexcept(false)
 		{
-			const auto iFind = std::lower_bound( ids_.begin(), ids_.end(), entityId );
-			if ( iFind == ids_.end() )
+			const auto iFind = lowerBound( entityId );
+			if ( iFind == ids_.end() || *iFind != entityId )
 				throw std::invalid_argument( "EntityId does not have this component type for call to Collection::get()");
 			return at(iFind);
 		}
 
+		/** Get pointers to the components of many entityIds in a single forward pass
+		 * The ids are resolved in ascending order, sorting a permutation when entityIds is not already sorted,
+		 * so each search gallops forward from the previous match and ids() is walked front-to-back.
+		 * @param[out] components  Receives the component of entityIds[i] at components[i], or nullptr if the entity has none
+		 */
+		void findMany( std::span<const EntityId> entityIds, std::span<Component*> components )
+		{
+			assert( components.size() >= entityIds.size() );
+			if ( std::is_sorted( entityIds.begin(), entityIds.end() ) )
+			{
+				findSorted( entityIds.size()
+					, [&]( size_t i ) { return entityIds[i]; }
+					, [&]( size_t i, Component* component ) { components[i] = component; } );
+			}
+			else
+			{
+				// Sort (id, index) pairs packed as integers to keep the comparisons branch-light and cache-compact
+				std::vector<uint64_t> order( entityIds.size() );
+				for ( size_t i = 0U; i != entityIds.size(); ++i )
+					order[i] = (uint64_t(entityIds[i].value) << 32U) | uint64_t(i);
+				std::sort( order.begin(), order.end() );
+				findSorted( order.size()
+					, [&]( size_t i ) { return EntityId{ static_cast<uint32_t>(order[i] >> 32U) }; }
+					, [&]( size_t i, Component* component ) { components[static_cast<uint32_t>(order[i])] = component; } );
+			}
+		}
+
 		Component& at( const Iterator& iEntity ) noexcept(true)
 		{
 			return components_.at( std::distance( ids_.begin(), iEntity ) );
@@ -88,21 +372,139 @@ namespace SubzeroECS {
 		Iterator end() 
 		{ return ids_.end(); }
 
+		/** Sorted ids of entities that have this component
+		*/
+		const EntityIdVector& ids() const noexcept(true)
+		{ return ids_; }
+
+		/** Component column where components()[i] belongs to entity ids()[i]
+		*/
+		ComponentVector& components() noexcept(true)
+		{ return components_; }
+
+		/** Hint that the columns are about to be iterated front-to-back, e.g. madvise for MappedFileStorage
+		*/
+		void adviseSequential() const noexcept(true)
+		{
+			if constexpr ( requires { ids_.adviseSequential(); } )
+				ids_.adviseSequential();
+			if constexpr ( requires { components_.adviseSequential(); } )
+				components_.adviseSequential();
+		}
+
+		/** Rebuild the search index after structural changes, @see ComponentSearchIndex
+		 * Lookups only read the index so they may run from several threads, falling back to a binary search
+		 * while the index is stale. Call between structural changes and lookups e.g. once per frame.
+		 */
+		void buildSearchIndex() requires HasSearchIndex
+		{
+			searchIndex_.index.build( std::span<const EntityId>( ids_.data(), ids_.size() ) );
+			searchIndex_.version = version_;
+		}
+
+		/** Search index of the ids as of the last buildSearchIndex()
+		*/
+		const SearchIndex& searchIndex() const noexcept(true) requires HasSearchIndex
+		{ return searchIndex_.index; }
+
+		/** True if the search index matches the ids so lookups use it
+		*/
+		bool searchIndexCurrent() const noexcept(true) requires HasSearchIndex
+		{ return searchIndex_.version == version_; }
+
+		/** Membership bitset with bit EntityId::value set for each entity that has this component
+		*/
+		const Utility::DynamicBitset& membership() const noexcept(true) requires HasMembership
+		{ return membership_; }
+
 		/** Get the number of entities that have this component
 		*/
 		size_t size() const noexcept(true)
 		{ return ids_.size(); }
 
+		/** Structural version incremented once for every entity added or removed
+		@remark Allows dependent indices e.g. Group to detect when they need rebuilding, the version
+		        and size grow by the same amount only when entities were appended
+		*/
+		uint64_t version() const noexcept(true)
+		{ return version_; }
+
 	private:
-		CollectionRegistry& registry_; //< Registry the collection is attached to
+
+		/** Resolve count ascending query ids with a galloping merge over ids_
+		 * @param queryId  Callable returning the i-th query id, ids must be non-decreasing
+		 * @param output   Callable receiving (i, component) for each query id
+		 */
+		template< typename QueryId, typename Output >
+		void findSorted( size_t count, QueryId&& queryId, Output&& output )
+		{
+			constexpr size_t PrefetchAhead = 64U / sizeof(EntityId); //< Next cache line of ids_
+			const EntityId* const ids = ids_.data();
+			const size_t size = ids_.size();
+			size_t position = 0U;
+			for ( size_t i = 0U; i != count; ++i )
+			{
+				const EntityId entityId = queryId(i);
+
+				// Gallop to bracket entityId in (position + bound/2, position + bound] then binary search the bracket
+				size_t bound = 1U;
+				while ( position + bound < size && ids[position + bound] < entityId )
+					bound *= 2U;
+				const EntityId* const iFirst = ids + position + bound / 2U;
+				const EntityId* const iLast = ids + std::min( position + bound + 1U, size );
+				position = static_cast<size_t>( std::lower_bound( iFirst, iLast, entityId ) - ids );
+
+				if ( position + PrefetchAhead < size )
+					Utility::prefetch( ids + position + PrefetchAhead );
+
+				if ( position != size && ids[position] == entityId )
+				{
+					Component* component = &components_[position];
+					Utility::prefetch( component );
+					output( i, component );
+				}
+				else
+				{
+					output( i, nullptr );
+				}
+			}
+		}
+
+		/** Iterator at the first id not less than entityId, searching the index if the component has one */
+		Iterator lowerBound( EntityId entityId )
+		{
+			if constexpr ( HasSearchIndex )
+			{
+				if ( searchIndexCurrent() )
+					return ids_.begin() + static_cast<std::ptrdiff_t>( searchIndex_.index.lowerBound( std::span<const EntityId>( ids_.data(), ids_.size() ), entityId ) );
+			}
+			return std::lower_bound( ids_.begin(), ids_.end(), entityId );
+		}
+
+	private:
+		CollectionRegistry* registry_; //< Registry the collection is attached to, nullptr if unregistered
+		uint64_t version_ = 0U; //< Structural change counter
 		
 		EntityIdVector ids_; //< ECS-entity ids for lookup
-		ComponentVector components_; //< Comoonent data
+		ComponentVector components_; //< Component data
+
+		struct NoMembership {};
+		[[no_unique_address]] std::conditional_t<HasMembership, Utility::DynamicBitset, NoMembership> membership_; //< Optional membership bitset
+
+		/** Search index with the version of the ids it was built for */
+		struct IndexedIds
+		{
+			SearchIndex index;
+			uint64_t version = 0U;
+		};
+		struct NoSearchIndex {};
+		[[no_unique_address]] std::conditional_t<HasSearchIndex, IndexedIds, NoSearchIndex> searchIndex_; //< Optional search index
 	};
 
 
 	/** Multiple Component collections with lifetime maintained by a single object
-	 * @TODO This could be specialised to provide better combined-lifetime for related components?  
+	 * The collection also acts as an owning Group: a View<Components...> in the same order uses the
+	 * group's packed join index instead of intersecting the component ids.
 	 * @tparam Components  List of Component types, a Collection<Compnent[X]> will be created for each typename
 	 */
 	template< typename... Components >
@@ -111,8 +513,16 @@ namespace SubzeroECS {
 	public:
 		//NOTE: C++11 std::make_tuple
 		Collection(CollectionRegistry& registry)
-			: collections_((sizeof(Components), registry)...)
+			: registry_(registry)
+			, collections_((sizeof(Components), registry)...)
+			, group_(std::get<Collection<Components>>(collections_)...)
+		{
+			registry_.registerCollection(this);
+		}
+
+		~Collection()
 		{
+			registry_.unregisterCollection(this);
 		}
 
 		//NOTE: C++14 std::get<>
@@ -122,9 +532,22 @@ namespace SubzeroECS {
 			return std::get<Collection<Component>>(collections_);
 		}
 
+		/** Group of entities having all Components */
+		Group<Components...>& group()
+		{ return group_; }
+
+		/** Remove every component from each collection retaining their allocations, @see Collection::clear() */
+		void clear() noexcept
+		{
+			std::apply( []( Collection<Components>&... collections ) { (collections.clear(), ...); }, collections_ );
+		}
+
 	private:
 		typedef std::tuple< Collection<Components>... > CollectionTuple;
+
+		CollectionRegistry& registry_; //< Registry the collection is attached to
 		CollectionTuple collections_;
+		Group<Components...> group_; //< Packed join index over collections_
 	};
 
 } //END: SubzeroECS
@@ -19,6 +19,21 @@ namespace SubzeroECS
 			buffer = buffer->next;
 		}
 	}
+
+	void CollectionRegistry::clearTransients() noexcept
+	{
+		for ( const Registered& registered : registered_ )
+		{
+			if ( registered.transient )
+				registered.clear( registered.collection );
+		}
+	}
+
+	void CollectionRegistry::clearCollections() noexcept
+	{
+		for ( const Registered& registered : registered_ )
+			registered.clear( registered.collection );
+	}
 } //END: SubzeroECS
 
 
@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <stdexcept>
+#include <vector>
 #include "UniqueIndex32.hpp"
 
 namespace SubzeroECS {
@@ -25,12 +26,13 @@ public:
 	~CollectionRegistry();
 	
 	/** Find the collection instance for the specified component
+	@remark Multiple Components find a multi-component Collection<Components...> with matching order
 	@return Collection instance or nullptr if no collection has been created for the Component type
 	*/
-	template< typename Component>
-	Collection<Component>* find() /*const*/
+	template< typename... Components>
+	Collection<Components...>* find() /*const*/
 	{ 
-		return getCollection<Component>().instances[registeryId_];
+		return getCollection<Components...>().instances[registeryId_];
 	}
 
 	/** Get the collection instance for the specified component
@@ -52,14 +54,14 @@ public:
 	
 	/** Set the collection for a component 
 	*/
-	template< typename Component>
-	void registerCollection( Collection<Component>* collection )
+	template< typename... Components>
+	void registerCollection( Collection<Components...>* collection )
 	{ 
-		CollectionInstances<Component>& collections = getCollection<Component>();
+		CollectionInstances<Components...>& collections = getCollection<Components...>();
 		if ( collections.instances[registeryId_] != nullptr )
 		{
 			throw std::invalid_argument( 
-				std::string("Collection already registered for Component of type ") + typeid(Component).name() );
+				std::string("Collection already registered for Component of type ") + typeid(Collection<Components...>).name() );
 		}
 
 		///Update a list of collection-buffers so we can release instances at desrruction
@@ -67,14 +69,17 @@ public:
 		bufferListHead_ = &collections;
 
 		collections.instances[registeryId_] = collection;
+
+		if constexpr ( sizeof...(Components) == 1U )
+			registered_.push_back( Registered{ collection, &clearCollection<Components...>, Collection<Components...>::IsTransient } );
 	}
 
 	/** Clear the collection for a component 
 	*/
-	template< typename Component>
-	void unregisterCollection( Collection<Component>* collection )
+	template< typename... Components>
+	void unregisterCollection( Collection<Components...>* collection )
 	{ 
-		CollectionInstances<Component>& collections = getCollection<Component>();
+		CollectionInstances<Components...>& collections = getCollection<Components...>();
 
 		// Verify the collection pointer matches our registry entry
 		assert( collections.instances[registeryId_] == collection ); 
@@ -100,7 +105,18 @@ public:
 		}
 
 		collections.instances[registeryId_] = nullptr;
+
+		if constexpr ( sizeof...(Components) == 1U )
+			std::erase_if( registered_, [collection]( const Registered& registered ) { return registered.collection == collection; } );
 	}
+
+	/** Empty every registered collection of a transient component e.g. at the end of a frame, @see ComponentTransient
+	*/
+	void clearTransients() noexcept;
+
+	/** Empty every registered collection retaining the collections, their registrations and allocations
+	*/
+	void clearCollections() noexcept;
 	
 private:
 
@@ -117,10 +133,10 @@ private:
 		virtual void unregisterCollection( const size_t index ) = 0;
 	};
 
-	template < typename Component >
+	template < typename... Components >
 	struct CollectionInstances : CollectionInstancesBase
 	{
-		Collection<Component>* instances[Capacity]{}; //< Collection instances for each RegistryCollection
+		Collection<Components...>* instances[Capacity]{}; //< Collection instances for each RegistryCollection
 
 		/** Make unpopulated instances buffer 
 		*/
@@ -140,15 +156,28 @@ private:
 	/** Collection instance buffer store for all CollectionRegistry instances within the system
 	@todo Document why this is static and try and remove?
 	*/
-	template < typename Component >
-	CollectionInstances<Component>& getCollection()
+	template < typename... Components >
+	CollectionInstances<Components...>& getCollection()
 	{
-		static CollectionInstances<Component> collections;
+		static CollectionInstances<Components...> collections;
 		return collections;
 	}
 
+	/** Registered single component collection with its type-erased clear */
+	struct Registered
+	{
+		void* collection;
+		void (*clear)( void* collection ) noexcept;
+		bool transient; ///< @see ComponentTransient
+	};
+
+	template< typename Component >
+	static void clearCollection( void* collection ) noexcept
+	{ static_cast<Collection<Component>*>(collection)->clear(); }
+
 private:
 	CollectionInstancesBase* bufferListHead_;
+	std::vector<Registered> registered_; //< Single component collections emptied by clearCollections()
 	const UniqueIndex32 registeryId_; //< Registry instance index
 };
 
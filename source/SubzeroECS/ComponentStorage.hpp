@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "Utility/IndirectVector.hpp"
+#include "Utility/MappedVector.hpp"
+#include "Utility/PagedVector.hpp"
+
+namespace SubzeroECS
+{
+	/** Default storage policy - components are held in a single contiguous std::vector
+	@remark Growth reallocates and copies the column, invalidating all component pointers
+	*/
+	struct VectorStorage
+	{
+		template< typename Component >
+		using Container = std::vector<Component>;
+
+		template< typename Id >
+		using IdContainer = std::vector<Id>; ///< Container of the sorted entity ids, must be contiguous
+	};
+
+	/** Paged storage policy - components are held in fixed-size pages referenced by a page table
+	@remark Growth never copies existing components and pointers remain stable while appending
+	@tparam PageBytes  Target size of each page in bytes
+	*/
+	template< std::size_t PageBytes = 16U * 1024U >
+	struct PagedStorage
+	{
+		template< typename Component >
+		using Container = Utility::PagedVector<Component, PageBytes>;
+
+		template< typename Id >
+		using IdContainer = std::vector<Id>;
+	};
+
+	/** Indirect storage policy - the column holds 4 byte handles into a stable pool of components
+	@remark Inserting or removing in the middle of the column shifts handles rather than components, which suits
+	heavy components e.g. holding strings or containers. Component pointers remain stable until removal, but
+	iteration reads the pool through the handles instead of streaming a contiguous column.
+	@tparam PageBytes  Target size of each pool page in bytes
+	*/
+	template< std::size_t PageBytes = 16U * 1024U >
+	struct IndirectStorage
+	{
+		template< typename Component >
+		using Container = Utility::IndirectVector<Component, PageBytes>;
+
+		template< typename Id >
+		using IdContainer = std::vector<Id>;
+	};
+
+#if defined(__unix__) || defined(__APPLE__)
+	/** Memory-mapped file storage policy - ids and components are held in files mapped into memory
+	 * For worlds that exceed physical memory, e.g. historical replay or batch simulation, the kernel pages
+	 * columns to and from their files and Views hint sequential access as they start iterating.
+	 * @remark Components must be trivially copyable, @see Utility::mappedFileDirectory() for the file location
+	 */
+	struct MappedFileStorage
+	{
+		template< typename Component >
+		using Container = Utility::MappedVector<Component>;
+
+		template< typename Id >
+		using IdContainer = Utility::MappedVector<Id>;
+	};
+#endif
+
+	/** Selects the storage policy used by Collection<Component>
+	 * Specialise for a component type to change how its column is stored e.g.
+	 * @code
+	 * template<> struct SubzeroECS::ComponentStorage<Position> : SubzeroECS::PagedStorage<> {};
+	 * @endcode
+	 * @warning The specialisation must be visible before Collection<Component> is instantiated
+	 */
+	template< typename Component >
+	struct ComponentStorage : VectorStorage
+	{};
+
+	/** Selects whether Collection<Component> keeps a dense membership bitset indexed by EntityId::value
+	 * The bitset makes has() a single bit test and allows Filter to match entities with bitwise operations,
+	 * costing one bit per EntityId up to the largest id holding the component e.g.
+	 * @code
+	 * template<> struct SubzeroECS::ComponentMembership<Frozen> : std::true_type {};
+	 * @endcode
+	 * @warning The specialisation must be visible before Collection<Component> is instantiated
+	 */
+	template< typename Component >
+	struct ComponentMembership : std::false_type
+	{};
+
+	/** Selects whether Component is a one-frame event e.g. a hit, collision or input
+	 * Events are added as ordinary components and read through normal Views. At the end of the frame
+	 * World::clearTransients() or StaticWorld::clearTransients() empties every transient collection at once,
+	 * keeping its capacity for the next frame. Clearing is O(1) for trivially destructible components e.g.
+	 * @code
+	 * template<> struct SubzeroECS::ComponentTransient<Hit> : std::true_type {};
+	 * @endcode
+	 * @warning The specialisation must be visible before Collection<Component> is instantiated
+	 */
+	template< typename Component >
+	struct ComponentTransient : std::false_type
+	{};
+
+	/** Selects whether components can be relocated by copying their bytes, without a move and destroy
+	 * Collection then shifts its std::vector column with memmove when creating or removing in the middle.
+	 * Defaults to trivially copyable components. Specialise it for components whose members are trivially
+	 * relocatable, e.g. std::vector or std::unique_ptr, but not members pointing into the object itself
+	 * such as the small string buffer of libstdc++'s std::string e.g.
+	 * @code
+	 * template<> struct SubzeroECS::ComponentRelocatable<Inventory> : std::true_type {};
+	 * @endcode
+	 * @warning The specialisation must be visible before Collection<Component> is instantiated
+	 */
+	template< typename Component >
+	struct ComponentRelocatable : std::is_trivially_copyable<Component>
+	{};
+
+	/** Selects whether Collection<Component> keeps a read-optimised SearchIndex beside its sorted ids
+	 * find(), get() and has() then search the index instead of binary searching the ids, which suits large
+	 * collections that are looked up far more often than they change. The index is rebuilt in O(n) by
+	 * Collection::buildSearchIndex(), lookups never write to it and binary search the ids while it is stale e.g.
+	 * @code
+	 * template<> struct SubzeroECS::ComponentSearchIndex<Terrain> : std::true_type {};
+	 * @endcode
+	 * @warning The specialisation must be visible before Collection<Component> is instantiated
+	 */
+	template< typename Component >
+	struct ComponentSearchIndex : std::false_type
+	{};
+
+} //END: SubzeroECS
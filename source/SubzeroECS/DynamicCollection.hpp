@@ -0,0 +1,371 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new> //< std::align_val_t
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility> //< std::move
+#include <vector>
+
+#include "EntityId.hpp"
+
+namespace SubzeroECS
+{
+	/// Runtime id of a dynamic component type, @see DynamicComponentRegistry
+	using DynamicComponentId = std::uint32_t;
+
+	/** Scalar type of a dynamic component field, required for field predicates @see RuntimeQuery */
+	enum class FieldType : std::uint8_t
+	{
+		Unknown, ///< Opaque bytes
+		Int32,
+		UInt32,
+		Float32,
+		Float64,
+	};
+
+	/** Named field of a dynamic component type */
+	struct ComponentField
+	{
+		std::string name; ///< Field name e.g. for scripts binding by name
+		std::uint32_t offset = 0U; ///< Byte offset within the component
+		std::uint32_t size = 0U; ///< Size in bytes
+		FieldType type = FieldType::Unknown; ///< Scalar type of the field
+	};
+
+	/** Size in bytes of a field type, 0 for FieldType::Unknown */
+	constexpr std::uint32_t fieldTypeSize( FieldType type ) noexcept
+	{
+		switch ( type )
+		{
+		case FieldType::Int32:
+		case FieldType::UInt32:
+		case FieldType::Float32: return 4U;
+		case FieldType::Float64: return 8U;
+		default: return 0U;
+		}
+	}
+
+	/** Memory layout of a component type defined at runtime e.g. by a script or data file
+	 * Components are plain bytes: constructed zero-filled or copied, and relocated with memcpy.
+	 */
+	struct ComponentLayout
+	{
+		std::string name; ///< Unique name of the component type
+		std::size_t size = 0U; ///< Size in bytes, a multiple of alignment, 0 for tag components
+		std::size_t alignment = 1U; ///< Alignment in bytes, a power of two
+		std::vector<ComponentField> fields; ///< Optional description of the bytes
+
+		/** Layout matching a trivially copyable C++ type, e.g. to share a component with native code */
+		template< typename T >
+		static ComponentLayout of( std::string name, std::vector<ComponentField> fields = {} )
+		{
+			static_assert( std::is_trivially_copyable_v<T>, "Dynamic components are relocated with memcpy" );
+			return ComponentLayout{ std::move(name), std::is_empty_v<T> ? 0U : sizeof(T), alignof(T), std::move(fields) };
+		}
+
+		/** Find a field by name
+		@return Field or nullptr if the layout has no such field
+		*/
+		const ComponentField* findField( std::string_view fieldName ) const noexcept
+		{
+			const auto iField = std::find_if( fields.begin(), fields.end(), [&]( const ComponentField& field ) { return field.name == fieldName; } );
+			return (iField != fields.end()) ? &*iField : nullptr;
+		}
+	};
+
+	/** Type-erased Collection of a dynamic component type
+	 *
+	 * Mirrors Collection<T>: ids are kept sorted with the components in a parallel column, so the ids take part
+	 * in the same set intersection as static components, @see DynamicView. The column is a single aligned
+	 * allocation of layout().size byte strides which is shifted and grown with memmove/memcpy.
+	 */
+	class DynamicCollection
+	{
+	public:
+		/** @throw std::invalid_argument if the layout is malformed */
+		DynamicCollection( DynamicComponentId componentId, ComponentLayout layout )
+			: componentId_(componentId)
+			, layout_(std::move(layout))
+		{
+			const std::size_t alignment = layout_.alignment;
+			if ( alignment == 0U || (alignment & (alignment - 1U)) != 0U || layout_.size % alignment != 0U )
+				throw std::invalid_argument( "Invalid alignment for dynamic component " + layout_.name );
+			for ( const ComponentField& field : layout_.fields )
+			{
+				if ( std::size_t(field.offset) + field.size > layout_.size )
+					throw std::invalid_argument( "Field " + field.name + " outside of dynamic component " + layout_.name );
+				if ( field.type != FieldType::Unknown && field.size != fieldTypeSize( field.type ) )
+					throw std::invalid_argument( "Field " + field.name + " size does not match its type in dynamic component " + layout_.name );
+			}
+		}
+
+		DynamicCollection( const DynamicCollection& ) = delete;
+		DynamicCollection& operator=( const DynamicCollection& ) = delete;
+
+		~DynamicCollection()
+		{ release( data_ ); }
+
+		/** Add the component of an entity
+		 * @param component  Bytes copied into the component, nullptr to zero-fill
+		 * @return Component bytes
+		 * @throw std::invalid_argument if the entity already has this component
+		 */
+		std::byte* create( EntityId entityId, const void* component = nullptr ) noexcept(false)
+		{
+			auto iFind = std::lower_bound( ids_.begin(), ids_.end(), entityId );
+			if ( iFind != ids_.end() && *iFind == entityId )
+				throw std::invalid_argument( "EntityId already has this component type for call to DynamicCollection::create()" );
+
+			const std::size_t index = static_cast<std::size_t>( iFind - ids_.begin() );
+			if ( ids_.size() == capacity_ )
+				grow(); //< Invalidates iFind
+			ids_.insert( ids_.begin() + static_cast<std::ptrdiff_t>(index), entityId );
+
+			const std::size_t stride = layout_.size;
+			std::byte* item = data_ + index * stride;
+			if ( stride != 0U )
+			{
+				std::memmove( item + stride, item, (ids_.size() - 1U - index) * stride );
+				if ( component != nullptr )
+					std::memcpy( item, component, stride );
+				else
+					std::memset( item, 0, stride );
+			}
+			++version_;
+			return item;
+		}
+
+		/** Remove the component of an entity
+		@return false if the entity did not have this component
+		*/
+		bool remove( EntityId entityId )
+		{
+			auto iFind = std::lower_bound( ids_.begin(), ids_.end(), entityId );
+			if ( iFind == ids_.end() || *iFind != entityId )
+				return false;
+
+			const std::size_t index = static_cast<std::size_t>( iFind - ids_.begin() );
+			const std::size_t stride = layout_.size;
+			if ( stride != 0U )
+				std::memmove( data_ + index * stride, data_ + (index + 1U) * stride, (ids_.size() - 1U - index) * stride );
+			ids_.erase( iFind );
+			++version_;
+			return true;
+		}
+
+		/** Remove the components of many entities in a single compacting pass, @see Collection::removeMany()
+		 * @param entityIds  Ids sorted ascending, ids without this component are ignored
+		 * @return Number of components removed
+		 */
+		std::size_t removeMany( std::span<const EntityId> entityIds )
+		{
+			assert( std::is_sorted( entityIds.begin(), entityIds.end() ) );
+			const std::size_t stride = layout_.size;
+			const std::size_t size = ids_.size();
+			std::size_t read = 0U;
+			std::size_t write = 0U;
+			auto keep = [&]( std::size_t next )
+			{
+				if ( write != read )
+				{
+					std::move( ids_.begin() + read, ids_.begin() + next, ids_.begin() + write );
+					if ( stride != 0U )
+						std::memmove( data_ + write * stride, data_ + read * stride, (next - read) * stride );
+				}
+				write += next - read;
+			};
+
+			for ( const EntityId entityId : entityIds )
+			{
+				const std::size_t next = static_cast<std::size_t>( std::lower_bound( ids_.begin() + read, ids_.end(), entityId ) - ids_.begin() );
+				if ( next == size || ids_[next] != entityId )
+					continue;
+				keep( next );
+				read = next + 1U;
+			}
+
+			const std::size_t removed = read - write;
+			if ( removed == 0U )
+				return 0U;
+			keep( size );
+			ids_.resize( size - removed );
+			++version_;
+			return removed;
+		}
+
+		bool has( EntityId entityId ) const
+		{
+			auto iFind = std::lower_bound( ids_.begin(), ids_.end(), entityId );
+			return iFind != ids_.end() && *iFind == entityId;
+		}
+
+		/** Get the component bytes of an entity
+		@return Component bytes or nullptr if the entity has no component
+		*/
+		std::byte* find( EntityId entityId ) noexcept(true)
+		{
+			auto iFind = std::lower_bound( ids_.begin(), ids_.end(), entityId );
+			return (iFind != ids_.end() && *iFind == entityId)
+				? at( static_cast<std::size_t>( iFind - ids_.begin() ) )
+				: nullptr;
+		}
+
+		/** Get the component bytes of an entity
+		@warning Will throw exception if the entityId was not found, use find() if component existance is unknown
+		*/
+		std::byte* get( EntityId entityId ) noexcept(false)
+		{
+			std::byte* component = find( entityId );
+			if ( component == nullptr )
+				throw std::invalid_argument( "EntityId does not have this component type for call to DynamicCollection::get()" );
+			return component;
+		}
+
+		/** Component bytes of the entity at ids()[index] */
+		std::byte* at( std::size_t index ) noexcept(true)
+		{ return data_ + index * layout_.size; }
+
+		/** Component bytes viewed as a C++ type of matching layout, @see ComponentLayout::of() */
+		template< typename T >
+		T& as( std::size_t index ) noexcept(true)
+		{
+			assert( sizeof(T) == layout_.size || (std::is_empty_v<T> && layout_.size == 0U) );
+			return *std::launder( reinterpret_cast<T*>( at( index ) ) );
+		}
+
+		/** Sorted ids of entities that have this component
+		*/
+		const std::vector<EntityId>& ids() const noexcept(true)
+		{ return ids_; }
+
+		/** Component column where the bytes of ids()[i] start at data() + i * layout().size
+		*/
+		std::byte* data() noexcept(true)
+		{ return data_; }
+
+		/** Get the number of entities that have this component
+		*/
+		std::size_t size() const noexcept(true)
+		{ return ids_.size(); }
+
+		/// Runtime id of the component type
+		DynamicComponentId componentId() const noexcept(true)
+		{ return componentId_; }
+
+		/// Layout of the component type
+		const ComponentLayout& layout() const noexcept(true)
+		{ return layout_; }
+
+		/** Monotonic counter incremented on every structural change, @see Collection::version() */
+		std::uint64_t version() const noexcept(true)
+		{ return version_; }
+
+	private:
+		/** Double the column capacity relocating the components with memcpy */
+		void grow()
+		{
+			const std::size_t capacity = std::max<std::size_t>( capacity_ * 2U, 16U );
+			ids_.reserve( capacity );
+			// Tag components keep a minimal allocation so find() returns non-null for present components
+			const std::size_t bytes = std::max( capacity * layout_.size, layout_.alignment );
+			std::byte* data = static_cast<std::byte*>( ::operator new( bytes, std::align_val_t{ layout_.alignment } ) );
+			if ( data_ != nullptr && layout_.size != 0U )
+				std::memcpy( data, data_, ids_.size() * layout_.size );
+			release( data_ );
+			data_ = data;
+			capacity_ = capacity;
+		}
+
+		void release( std::byte* data ) noexcept
+		{
+			if ( data != nullptr )
+				::operator delete( data, std::align_val_t{ layout_.alignment } );
+		}
+
+	private:
+		DynamicComponentId componentId_; //< Runtime id of the component type
+		ComponentLayout layout_; //< Layout of the component type
+		std::vector<EntityId> ids_; //< Sorted ids of entities with the component
+		std::byte* data_ = nullptr; //< Aligned component column of capacity_ elements
+		std::size_t capacity_ = 0U; //< Components that fit in data_
+		std::uint64_t version_ = 0U; //< Incremented on structural change
+	};
+
+	/** Registry of dynamic component types and their collections keyed by DynamicComponentId
+	 * Owned alongside a World or StaticWorld, dynamic components share the world's EntityIds.
+	 */
+	class DynamicComponentRegistry
+	{
+	public:
+		/** Register a component type defined at runtime
+		 * @return Id of the component type, ids are allocated consecutively from 0
+		 * @throw std::invalid_argument if the name is already registered or the layout is malformed
+		 */
+		DynamicComponentId registerComponent( ComponentLayout layout )
+		{
+			if ( find( layout.name ) != nullptr )
+				throw std::invalid_argument( "Dynamic component already registered " + layout.name );
+			const DynamicComponentId componentId = static_cast<DynamicComponentId>( collections_.size() );
+			collections_.push_back( std::make_unique<DynamicCollection>( componentId, std::move(layout) ) );
+			return componentId;
+		}
+
+		/** Find the collection of a component type
+		@return Collection or nullptr if the id is not registered
+		*/
+		DynamicCollection* find( DynamicComponentId componentId ) noexcept
+		{ return (componentId < collections_.size()) ? collections_[componentId].get() : nullptr; }
+
+		/** Find the collection of a component type by name
+		@return Collection or nullptr if the name is not registered
+		*/
+		DynamicCollection* find( std::string_view name ) noexcept
+		{
+			for ( const std::unique_ptr<DynamicCollection>& collection : collections_ )
+			{
+				if ( collection->layout().name == name )
+					return collection.get();
+			}
+			return nullptr;
+		}
+
+		/** Get the collection of a component type
+		@warning Exception will be thrown if the id is not registered
+		*/
+		DynamicCollection& get( DynamicComponentId componentId )
+		{
+			DynamicCollection* collection = find( componentId );
+			if ( collection == nullptr )
+				throw std::invalid_argument( "Dynamic component not registered for id " + std::to_string(componentId) );
+			return *collection;
+		}
+
+		/** Remove every dynamic component of an entity
+		@return Number of components removed
+		*/
+		std::size_t remove( EntityId entityId )
+		{
+			std::size_t removed = 0U;
+			for ( const std::unique_ptr<DynamicCollection>& collection : collections_ )
+				removed += collection->remove( entityId ) ? 1U : 0U;
+			return removed;
+		}
+
+		/// Number of registered component types
+		std::size_t size() const noexcept
+		{ return collections_.size(); }
+
+	private:
+		std::vector< std::unique_ptr<DynamicCollection> > collections_; //< Collections indexed by DynamicComponentId
+	};
+
+} //END: SubzeroECS
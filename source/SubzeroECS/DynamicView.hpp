@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new> //< std::launder
+#include <span>
+#include <tuple>
+#include <utility> //< std::index_sequence
+#include <vector>
+
+#include "Collection.hpp"
+#include "CollectionRegistry.hpp"
+#include "DynamicCollection.hpp"
+#include "Intersection.hpp"
+#include "StaticWorld.hpp"
+#include "View.hpp" //< Detail::columnBase
+
+namespace SubzeroECS
+{
+	/** Entity of a DynamicView giving access to its dynamic components */
+	class DynamicRow
+	{
+	public:
+		DynamicRow( EntityId entityId, std::byte* const* components ) noexcept
+			: id_( entityId )
+			, components_( components )
+		{}
+
+		EntityId id() const noexcept
+		{ return id_; }
+
+		operator EntityId() const noexcept
+		{ return id_; }
+
+		/** Bytes of the dynamic component in the given column of the view */
+		std::byte* operator[]( std::size_t column ) const noexcept
+		{ return components_[column]; }
+
+		/** Field of a dynamic component, @see ComponentLayout::findField() */
+		template< typename T >
+		T& field( std::size_t column, std::uint32_t offset ) const noexcept
+		{ return *std::launder( reinterpret_cast<T*>( components_[column] + offset ) ); }
+
+	private:
+		EntityId id_;
+		std::byte* const* components_; ///< Component bytes per dynamic column
+	};
+
+	/** View over entities with all of the static Components and a runtime list of dynamic components
+	 *
+	 * The sorted id columns of both kinds of collection are intersected together by the runtime-arity
+	 * galloping of Intersection::beginRuntime(), so dynamic components filter exactly like static ones.
+	 * @code
+	 * const DynamicComponentId ids[] = { registry.registerComponent( layout ) };
+	 * DynamicView<Position> view( world, registry, ids );
+	 * view.each( [&]( const DynamicRow& row, Position& position ) { position.x += row.field<float>( 0U, speedOffset ); } );
+	 * @endcode
+	 *
+	 * @tparam Components  Static components, each passed by reference to each() after the DynamicRow
+	 */
+	template< typename... Components >
+	class DynamicView
+	{
+	public:
+		using Collections = std::tuple< Collection<Components>&... >; ///< Static component collections
+
+		/** @throw std::invalid_argument if a static or dynamic collection is not registered */
+		DynamicView( CollectionRegistry& registry, DynamicComponentRegistry& dynamic, std::span<const DynamicComponentId> componentIds )
+			: collections_( registry.get<Components>()... )
+		{
+			resolve( dynamic, componentIds );
+		}
+
+		/** @throw std::invalid_argument if a dynamic collection is not registered */
+		template< typename... WorldComponents >
+		DynamicView( StaticWorld<WorldComponents...>& world, DynamicComponentRegistry& dynamic, std::span<const DynamicComponentId> componentIds )
+			: collections_( world.template get<Components>()... )
+		{
+			resolve( dynamic, componentIds );
+		}
+
+		/// Collection of the dynamic component in the given column
+		DynamicCollection& dynamicCollection( std::size_t column ) noexcept
+		{ return *dynamic_[column]; }
+
+		/// Number of dynamic components
+		std::size_t dynamicCount() const noexcept
+		{ return dynamic_.size(); }
+
+		/** Number of entities in the view */
+		std::size_t count()
+		{
+			std::size_t result = 0U;
+			if ( beginCursors() )
+			{
+				do
+				{
+					++result;
+				}
+				while ( Intersection::incrementRuntime( cursors_ ) );
+			}
+			return result;
+		}
+
+		/** Invoke func( const DynamicRow&, Components&... ) for every entity in the view */
+		template< typename Func >
+		void each( Func&& func )
+		{
+			eachImpl( func, std::index_sequence_for<Components...>{} );
+		}
+
+	private:
+		void resolve( DynamicComponentRegistry& dynamic, std::span<const DynamicComponentId> componentIds )
+		{
+			dynamic_.reserve( componentIds.size() );
+			for ( const DynamicComponentId componentId : componentIds )
+				dynamic_.push_back( &dynamic.get( componentId ) );
+			components_.resize( dynamic_.size() );
+		}
+
+		/** Position the cursors at the first entity
+		@return false if the view is empty
+		*/
+		bool beginCursors()
+		{
+			cursors_.clear();
+			std::apply( [this]( Collection<Components>&... collections )
+			{
+				(cursors_.push_back( Intersection::Cursor{ collections.ids().data(), collections.ids().data() + collections.size() } ), ...);
+			}, collections_ );
+			for ( DynamicCollection* collection : dynamic_ )
+				cursors_.push_back( Intersection::Cursor{ collection->ids().data(), collection->ids().data() + collection->size() } );
+
+			return !cursors_.empty() && Intersection::beginRuntime( cursors_ );
+		}
+
+		template< typename Func, std::size_t... Is >
+		void eachImpl( Func& func, std::index_sequence<Is...> )
+		{
+			if ( !beginCursors() )
+				return;
+
+			constexpr std::size_t StaticCount = sizeof...(Components);
+			auto columns = std::make_tuple( Detail::columnBase( std::get<Is>(collections_).components() )... );
+			const EntityId* const ids[] = { std::get<Is>(collections_).ids().data()..., nullptr };
+			(void)ids; //< Unused without static components
+
+			// Hoist the dynamic column bases and strides out of the loop
+			const std::size_t dynamicCount = dynamic_.size();
+			std::vector<const EntityId*> dynamicIds( dynamicCount );
+			std::vector<std::byte*> dynamicBases( dynamicCount );
+			std::vector<std::size_t> strides( dynamicCount );
+			for ( std::size_t column = 0U; column < dynamicCount; ++column )
+			{
+				dynamicIds[column] = dynamic_[column]->ids().data();
+				dynamicBases[column] = dynamic_[column]->data();
+				strides[column] = dynamic_[column]->layout().size;
+			}
+
+			do
+			{
+				for ( std::size_t column = 0U; column < dynamicCount; ++column )
+				{
+					const std::size_t index = static_cast<std::size_t>( cursors_[StaticCount + column].it - dynamicIds[column] );
+					components_[column] = dynamicBases[column] + index * strides[column];
+				}
+				const DynamicRow row( *cursors_[0].it, components_.data() );
+				func( row, std::get<Is>(columns)[ static_cast<std::size_t>( cursors_[Is].it - ids[Is] ) ]... );
+			}
+			while ( Intersection::incrementRuntime( cursors_ ) );
+		}
+
+	private:
+		Collections collections_; //< Static component collections
+		std::vector<DynamicCollection*> dynamic_; //< Dynamic component collections by column
+		std::vector<Intersection::Cursor> cursors_; //< Static then dynamic id cursors
+		std::vector<std::byte*> components_; //< Dynamic component bytes of the current entity
+	};
+
+} //END: SubzeroECS
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <compare>
@@ -34,5 +35,19 @@ namespace SubzeroECS
 	constexpr inline bool isNull( EntityId entityId )
 	{ return entityId == EntityId::Invalid; }
 
+	/** Block of consecutive entity ids e.g. from World::createRange() */
+	struct EntityRange
+	{
+		EntityId first = EntityId::Invalid; ///< Id of the first entity
+		std::size_t count = 0U; ///< Number of entities
+
+		bool contains( EntityId entityId ) const noexcept
+		{ return !isNull(first) && entityId.value >= first.value && entityId.value - first.value < count; }
+
+		/// Id of the i'th entity
+		EntityId operator[]( std::size_t index ) const noexcept
+		{ return EntityId{ static_cast<std::uint32_t>( first.value + index ) }; }
+	};
+
 } //END: SubzeroECS
 
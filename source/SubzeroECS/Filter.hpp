@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm> //< std::min
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+#include "Collection.hpp"
+#include "CollectionRegistry.hpp"
+#include "EntityId.hpp"
+#include "StaticWorld.hpp"
+#include "Utility/DynamicBitset.hpp"
+
+namespace SubzeroECS
+{
+	/** Filter term listing components an entity must have */
+	template< typename... Components >
+	struct With {};
+
+	/** Filter term listing components an entity must not have */
+	template< typename... Components >
+	struct Without {};
+
+	template< typename WithTerm, typename WithoutTerm = Without<> >
+	class Filter;
+
+	/** Matches entities by combining the membership bitsets of their component collections
+	 *
+	 * Each 256-bit block of ids is resolved with word-wise AND / AND-NOT over all listed collections
+	 * (vectorised by the compiler) and only the surviving bits are visited, so sparse matches over many
+	 * required and excluded components cost mostly bitwise operations rather than id intersections.
+	 *
+	 * @tparam Required  Components an entity must have, at least one
+	 * @tparam Excluded  Components an entity must not have
+	 * @remark Every component must enable ComponentMembership
+	 */
+	template< typename... Required, typename... Excluded >
+	class Filter< With<Required...>, Without<Excluded...> >
+	{
+	public:
+		using Word = Utility::DynamicBitset::Word;
+		static constexpr std::size_t BlockWords = Utility::DynamicBitset::BlockWords;
+
+		static_assert( sizeof...(Required) > 0U, "Filter requires at least one With<> component" );
+		static_assert( (Collection<Required>::HasMembership && ...) && (Collection<Excluded>::HasMembership && ...),
+			"Filter components must enable ComponentMembership" );
+
+		Filter( CollectionRegistry& registry )
+			: required_( registry.get<Required>()... )
+			, excluded_( registry.get<Excluded>()... )
+		{}
+
+		template< typename... WorldComponents >
+		Filter( StaticWorld<WorldComponents...>& world )
+			: required_( world.template get<Required>()... )
+			, excluded_( world.template get<Excluded>()... )
+		{}
+
+		/** Invoke func(EntityId) for each matching entity in ascending id order */
+		template< typename Func >
+		void each( Func&& func ) const
+		{
+			eachWord( [&]( std::size_t firstIndex, Word word )
+			{
+				Utility::forEachSetBit( word, firstIndex, [&]( std::size_t index )
+				{
+					func( EntityId{ static_cast<std::uint32_t>(index) } );
+				});
+			});
+		}
+
+		/** Number of matching entities */
+		std::size_t count() const
+		{
+			std::size_t result = 0U;
+			eachWord( [&]( std::size_t, Word word ) { result += static_cast<std::size_t>( std::popcount( word ) ); } );
+			return result;
+		}
+
+	private:
+
+		/** Invoke func(firstIndex, word) for each non-zero matching word */
+		template< typename Func >
+		void eachWord( Func&& func ) const
+		{
+			const std::size_t wordCount = std::apply( []( const auto&... collections )
+				{ return std::min( { collections.membership().wordCount()... } ); }, required_ );
+
+			for ( std::size_t w = 0U; w < wordCount; w += BlockWords )
+			{
+				Word block[BlockWords];
+				std::apply( [&]( const auto& first, const auto&... rest )
+				{
+					const Word* const words = first.membership().words() + w;
+					for ( std::size_t k = 0U; k != BlockWords; ++k )
+						block[k] = words[k];
+					(andBlock( block, rest.membership(), w ), ...);
+				}, required_ );
+				std::apply( [&]( const auto&... collections ) { (andNotBlock( block, collections.membership(), w ), ...); }, excluded_ );
+
+				for ( std::size_t k = 0U; k != BlockWords; ++k )
+				{
+					if ( block[k] != 0U )
+						func( (w + k) * Utility::DynamicBitset::WordBits, block[k] );
+				}
+			}
+		}
+
+		static void andBlock( Word (&block)[BlockWords], const Utility::DynamicBitset& bits, std::size_t w ) noexcept
+		{
+			const Word* const words = bits.words() + w; //< Within bounds as w is below the minimum required word count
+			for ( std::size_t k = 0U; k != BlockWords; ++k )
+				block[k] &= words[k];
+		}
+
+		static void andNotBlock( Word (&block)[BlockWords], const Utility::DynamicBitset& bits, std::size_t w ) noexcept
+		{
+			if ( w >= bits.wordCount() )
+				return; //< Bits beyond the stored words are zero
+			const Word* const words = bits.words() + w;
+			for ( std::size_t k = 0U; k != BlockWords; ++k )
+				block[k] &= ~words[k];
+		}
+
+	private:
+		std::tuple< const Collection<Required>&... > required_; //< Collections entities must be members of
+		std::tuple< const Collection<Excluded>&... > excluded_; //< Collections entities must not be members of
+	};
+
+} //END: SubzeroECS
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm> //< std::min
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility> //< std::index_sequence
+#include <vector>
+
+#include "Collection.hpp"
+#include "CollectionRegistry.hpp"
+#include "Intersection.hpp"
+#include "StaticWorld.hpp"
+#include "System.hpp"
+#include "Utility/CallableTraits.hpp"
+#include "View.hpp"
+
+namespace SubzeroECS
+{
+	namespace Detail
+	{
+		template< typename... Ts >
+		struct TypeList
+		{
+			static constexpr std::size_t size = sizeof...(Ts);
+		};
+
+		/** Append the types not already in List in order */
+		template< typename List, typename... Ts >
+		struct AppendUnique
+		{
+			using type = List;
+		};
+
+		template< typename... Us, typename T, typename... Ts >
+		struct AppendUnique< TypeList<Us...>, T, Ts... >
+			: AppendUnique< std::conditional_t<(std::is_same_v<T, Us> || ...), TypeList<Us...>, TypeList<Us..., T>>, Ts... >
+		{};
+
+		/** Components of a View as a TypeList */
+		template< typename ViewType >
+		struct ViewComponents;
+
+		template< typename... Components >
+		struct ViewComponents< View<Components...> >
+		{
+			using type = TypeList<Components...>;
+		};
+
+		/** Union of the components of several views in order of first appearance */
+		template< typename List, typename... Views >
+		struct UnionComponents
+		{
+			using type = List;
+		};
+
+		template< typename List, typename... Components, typename... Views >
+		struct UnionComponents< List, View<Components...>, Views... >
+			: UnionComponents< typename AppendUnique<List, Components...>::type, Views... >
+		{};
+
+		template< typename ComponentList, typename... Systems >
+		class FusedSystemBase;
+
+		/** Implementation of FusedSystem over the union of the system components */
+		template< typename... Components, typename... Systems >
+		class FusedSystemBase< TypeList<Components...>, Systems... > : public ISystem
+		{
+		public:
+			using Collections = std::tuple< Collection<Components>&... >; ///< Union of the system component collections
+			using Row = std::array<std::uint32_t, sizeof...(Components)>; ///< Position of an entity in each union column
+
+			FusedSystemBase( CollectionRegistry& registry, Systems&... systems )
+				: collections_( registry.get<Components>()... )
+				, systemCollections_( makeSystemCollections<Systems>()... )
+				, systems_( systems... )
+				, views_( static_cast<Repeat<CollectionRegistry&, Systems>>(registry)... )
+			{}
+
+			template< typename... WorldComponents >
+			FusedSystemBase( StaticWorld<WorldComponents...>& world, Systems&... systems )
+				: collections_( world.template get<Components>()... )
+				, systemCollections_( makeSystemCollections<Systems>()... )
+				, systems_( systems... )
+				, views_( static_cast<Repeat<StaticWorld<WorldComponents...>&, Systems>>(world)... )
+			{}
+
+			/** Run every system over its entities
+			 * Entities with the components of all systems are processed in a single pass calling each system in
+			 * turn, the remaining entities of each system in a pass of their own.
+			 */
+			void update() override
+			{
+				fused_.clear();
+				fusedPass( std::index_sequence_for<Components...>{} );
+				remainderPasses( std::index_sequence_for<Systems...>{} );
+			}
+
+			/** Number of entities processed by the single pass of the last update() */
+			std::size_t fusedCount() const noexcept
+			{ return fused_.size(); }
+
+		private:
+			/** T once per element of a pack expansion */
+			template< typename T, typename >
+			using Repeat = T;
+
+			template< typename TSystem >
+			using SystemCollections = typename TSystem::Iterator::Collections;
+
+			template< typename TSystem >
+			SystemCollections<TSystem> makeSystemCollections()
+			{
+				return makeCollections( static_cast<typename ViewComponents<typename TSystem::ViewType>::type*>(nullptr) );
+			}
+
+			template< typename... SystemComponents >
+			std::tuple< Collection<SystemComponents>&... > makeCollections( TypeList<SystemComponents...>* )
+			{
+				return std::tuple< Collection<SystemComponents>&... >( std::get<Collection<SystemComponents>&>(collections_)... );
+			}
+
+			template< std::size_t... Is >
+			void fusedPass( std::index_sequence<Is...> indices )
+			{
+				(std::get<Is>(collections_).adviseSequential(), ...);
+				auto columns = std::make_tuple( columnBase( std::get<Is>(collections_).components() )... );
+				const EntityId* const ids[] = { std::get<Is>(collections_).ids().data()... };
+				auto iterators = std::make_tuple( ids[Is]... );
+				const auto endIterators = std::make_tuple( (ids[Is] + std::get<Is>(collections_).size())... );
+				if ( !Intersection::beginN( indices, iterators, endIterators ) )
+					return;
+
+				do
+				{
+					const EntityId entityId = *std::get<0>(iterators);
+					const Row row{ static_cast<std::uint32_t>( std::get<Is>(iterators) - ids[Is] )... };
+					fused_.push_back( entityId );
+					processFused( entityId, row, columns, std::index_sequence_for<Systems...>{} );
+				}
+				while ( Intersection::incrementN( indices, iterators, endIterators ) );
+			}
+
+			template< typename Columns, std::size_t... Ss >
+			void processFused( EntityId entityId, const Row& row, Columns& columns, std::index_sequence<Ss...> )
+			{
+				(processFusedSystem( std::get<Ss>(systems_), std::get<Ss>(systemCollections_), entityId, row, columns ), ...);
+			}
+
+			template< typename TSystem, typename Columns >
+			static void processFusedSystem( TSystem& system, SystemCollections<TSystem>& collections, EntityId entityId, const Row& row, Columns& columns )
+			{
+				if constexpr ( requires( TSystem& s, typename TSystem::Iterator it ) { s.processEntity(it); } )
+				{
+					// Position the system's own iterator on the row, as a single row owning group
+					using SystemIterator = typename TSystem::Iterator;
+					const typename SystemIterator::GroupRow systemRow = systemRowOf( row, static_cast<typename ViewComponents<typename TSystem::ViewType>::type*>(nullptr) );
+					SystemIterator iEntity( collections, &systemRow, &systemRow + 1 );
+					system.processEntity( iEntity );
+				}
+				else
+				{
+					using Arguments = typename Utility::CallableTraits<decltype(&TSystem::processEntity)>::Arguments;
+					processFusedArguments( system, entityId, row, columns, static_cast<Arguments*>(nullptr) );
+				}
+			}
+
+			template< typename... SystemComponents >
+			static std::array<std::uint32_t, sizeof...(SystemComponents)> systemRowOf( const Row& row, TypeList<SystemComponents...>* )
+			{
+				return { row[ get_type_index<SystemComponents, Components...>::value ]... };
+			}
+
+			template< typename TSystem, typename Columns, typename... Args >
+			static void processFusedArguments( TSystem& system, EntityId entityId, const Row& row, Columns& columns, std::tuple<Args...>* )
+			{
+				system.processEntity( fusedArgument<Args>( entityId, row, columns )... );
+			}
+
+			template< typename Arg, typename Columns >
+			static decltype(auto) fusedArgument( EntityId entityId, const Row& row, Columns& columns )
+			{
+				if constexpr ( std::is_same_v<Bare<Arg>, EntityId> )
+				{
+					return entityId;
+				}
+				else
+				{
+					constexpr std::size_t iComponent = get_type_index<Bare<Arg>, Components...>::value;
+					return (std::get<iComponent>(columns)[ row[iComponent] ]);
+				}
+			}
+
+			template< std::size_t... Ss >
+			void remainderPasses( std::index_sequence<Ss...> )
+			{
+				(remainderPass<Ss>(), ...);
+			}
+
+			/** Process the entities of a system that were not in the fused pass i.e. lack some other system's component */
+			template< std::size_t S >
+			void remainderPass()
+			{
+				using TSystem = std::tuple_element_t<S, std::tuple<Systems...>>;
+				if constexpr ( ViewComponents<typename TSystem::ViewType>::type::size == sizeof...(Components) )
+				{
+					return; //< Same components as the fused pass
+				}
+				else
+				{
+					// The view has at most as many entities as its smallest collection, all of which may have been fused
+					SystemCollections<TSystem>& collections = std::get<S>(systemCollections_);
+					const std::size_t bound = std::apply( []( auto&... collection ) { return std::min( { collection.size()... } ); }, collections );
+					if ( bound == fused_.size() )
+						return;
+
+					TSystem& system = std::get<S>(systems_);
+					auto& view = std::get<S>(views_);
+					std::size_t iFused = 0U;
+					const auto iEnd = view.end();
+					for ( auto iEntity = view.begin(); iEntity != iEnd; ++iEntity )
+					{
+						const EntityId entityId = iEntity;
+						while ( iFused < fused_.size() && fused_[iFused] < entityId )
+							++iFused;
+						if ( iFused < fused_.size() && fused_[iFused] == entityId )
+							continue;
+						processRemainder( system, iEntity );
+					}
+				}
+			}
+
+			template< typename TSystem >
+			static void processRemainder( TSystem& system, const typename TSystem::Iterator& iEntity )
+			{
+				if constexpr ( requires( TSystem& s, typename TSystem::Iterator it ) { s.processEntity(it); } )
+				{
+					system.processEntity( iEntity );
+				}
+				else
+				{
+					using Arguments = typename Utility::CallableTraits<decltype(&TSystem::processEntity)>::Arguments;
+					processRemainderArguments( system, iEntity, static_cast<Arguments*>(nullptr) );
+				}
+			}
+
+			template< typename TSystem, typename... Args >
+			static void processRemainderArguments( TSystem& system, const typename TSystem::Iterator& iEntity, std::tuple<Args...>* )
+			{
+				system.processEntity( remainderArgument<Args>( iEntity )... );
+			}
+
+			template< typename Arg, typename Iterator >
+			static decltype(auto) remainderArgument( const Iterator& iEntity )
+			{
+				if constexpr ( std::is_same_v<Bare<Arg>, EntityId> )
+					return static_cast<EntityId>( iEntity );
+				else
+					return (iEntity.template get<Bare<Arg>>());
+			}
+
+		private:
+			Collections collections_; //< Union of the system component collections
+			std::tuple< SystemCollections<Systems>... > systemCollections_; //< Component collections of each system
+			std::tuple< Systems&... > systems_; //< Fused systems in call order
+			std::tuple< typename Systems::ViewType... > views_; //< View of each system for its remainder pass
+			std::vector<EntityId> fused_; //< Entities processed by the fused pass, ascending
+		};
+	} //END: Detail
+
+	/** Runs several systems in a single pass over the entities they share
+	 *
+	 * Each System normally streams its columns separately, e.g. Velocity is read by gravity, movement and
+	 * collision systems in turn. FusedSystem intersects the union of the system components once and calls
+	 * every system's processEntity() for each entity in that intersection, so shared columns are read once.
+	 * Entities that only some of the systems match are then processed by a pass of each such system, skipped
+	 * without iterating when the collection sizes show there are none.
+	 * @code
+	 * FusedSystem<GravitySystem, MovementSystem, BoundaryCollisionSystem> physics( world, gravity, movement, boundary );
+	 * physics.update();
+	 * @endcode
+	 *
+	 * Per entity the systems run in the order given, so a system reading a component written by an earlier
+	 * system sees the same value as when the systems are updated one after another.
+	 * @warning Only fuse systems whose processEntity() accesses the components of the entity it is given and
+	 * makes no structural changes. A system reading other entities, e.g. a neighbour written by an earlier
+	 * system, sees a partially updated world and must be updated on its own.
+	 * @tparam Systems  System derived classes, which keep their own parameters e.g. deltaTime
+	 */
+	template< typename... Systems >
+	class FusedSystem : public Detail::FusedSystemBase< typename Detail::UnionComponents<Detail::TypeList<>, typename Systems::ViewType...>::type, Systems... >
+	{
+		static_assert( sizeof...(Systems) >= 1U, "FusedSystem requires at least one system" );
+
+	public:
+		using Base = Detail::FusedSystemBase< typename Detail::UnionComponents<Detail::TypeList<>, typename Systems::ViewType...>::type, Systems... >;
+		using Base::Base;
+	};
+
+} //END: SubzeroECS
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <utility> //< std::index_sequence
+#include <vector>
+
+#include "EntityId.hpp"
+#include "Intersection.hpp"
+
+namespace SubzeroECS
+{
+	template< typename... Components >
+	class Collection;
+
+	/** Packed join index for entities that have all of the grouped Components
+	 *
+	 * Each row holds the position of one matching entity in every component column. Rows are in
+	 * EntityId order, which is also the order of each column, so iterating the rows walks every
+	 * column forwards with no set-intersection.
+	 *
+	 * The rows are rebuilt lazily by sync() when a column changes structurally. When the columns only
+	 * had entities appended (the common case as EntityIds are allocated incrementally) just the tail
+	 * of the rows is re-merged.
+	 *
+	 * @remark Columns remain sorted by EntityId as required by Collection::find() and the Intersection
+	 *         engine, so group members are indexed rather than physically moved to the column front.
+	 * @tparam Components  Grouped component types (at least two)
+	 */
+	template< typename... Components >
+	class Group
+	{
+	public:
+		static_assert( sizeof...(Components) > 1U, "Group requires at least two components" );
+
+		static constexpr std::size_t Size = sizeof...(Components); ///< number of components
+
+		using Index = std::uint32_t; ///< Position within a component column
+		using Row = std::array<Index, Size>; ///< Column positions of a single entity
+		using Rows = std::vector<Row>;
+		using Collections = std::tuple< Collection<Components>&... >;
+
+		Group( Collection<Components>&... collections )
+			: collections_( collections... )
+		{}
+
+		/** Bring the rows up to date with any structural changes to the columns
+		@return Rows for all entities having every grouped component
+		*/
+		const Rows& sync()
+		{
+			syncImpl( std::index_sequence_for<Components...>{} );
+			return rows_;
+		}
+
+		/** Number of entities in the group as of the last sync() */
+		std::size_t size() const noexcept
+		{ return rows_.size(); }
+
+	private:
+
+		/** Per-column state captured at the last sync() */
+		struct ColumnState
+		{
+			std::uint64_t version = ~std::uint64_t(0U); ///< Collection::version() at sync
+			std::size_t size = 0U; ///< Collection::size() at sync
+			EntityId lastId = EntityId::Invalid; ///< Last EntityId in the column at sync
+		};
+
+		template< std::size_t... Is >
+		void syncImpl( std::index_sequence<Is...> indices )
+		{
+			auto& cols = collections_;
+
+			if ( ((std::get<Is>(cols).version() == states_[Is].version) && ...) )
+				return; // Nothing changed
+
+			// Appends only if each column grew by exactly the number of changes with its previous
+			// last entity left in place, any insert before it would have shifted it along
+			const bool appendOnly = ((states_[Is].size != 0U
+				&& std::get<Is>(cols).version() - states_[Is].version == std::get<Is>(cols).size() - states_[Is].size
+				&& *(std::get<Is>(cols).begin() + (states_[Is].size - 1U)) == states_[Is].lastId) && ...);
+
+			auto iterators = std::make_tuple( std::get<Is>(cols).begin()... );
+			if ( appendOnly )
+			{
+				// Rows up to the lowest previous last entity cannot have changed
+				EntityId threshold = states_[0].lastId;
+				((threshold = std::min( threshold, states_[Is].lastId )), ...);
+				while ( !rows_.empty() && *(std::get<0>(cols).begin() + rows_.back()[0]) > threshold )
+					rows_.pop_back();
+
+				const EntityId first = EntityId{ threshold.value + 1U };
+				((std::get<Is>(iterators) = std::lower_bound( std::get<Is>(cols).begin(), std::get<Is>(cols).end(), first )), ...);
+			}
+			else
+			{
+				rows_.clear();
+			}
+
+			const auto endIterators = std::make_tuple( std::get<Is>(cols).end()... );
+			if ( Intersection::beginN( indices, iterators, endIterators ) )
+			{
+				do
+				{
+					rows_.push_back( Row{ static_cast<Index>(std::get<Is>(iterators) - std::get<Is>(cols).begin())... } );
+				}
+				while ( Intersection::incrementN( indices, iterators, endIterators ) );
+			}
+
+			((states_[Is] = ColumnState{ std::get<Is>(cols).version(), std::get<Is>(cols).size(),
+				std::get<Is>(cols).size() != 0U ? *(std::get<Is>(cols).end() - 1) : EntityId::Invalid }), ...);
+		}
+
+	private:
+		Collections collections_; ///< Grouped component columns
+		Rows rows_; ///< Column positions of each group member in EntityId order
+		std::array<ColumnState, Size> states_{}; ///< Column state at last sync
+	};
+
+} //END: SubzeroECS
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm> //< std::lower_bound
+#include <span>
 #include <tuple>
 
 #include "EntityId.hpp"
@@ -221,5 +222,158 @@ namespace SubzeroECS
 			return intersectN(indices, iterators, endIterators);
 		}
 
+		/** Position within a sorted id column for intersections whose arity is only known at runtime */
+		struct Cursor
+		{
+			const EntityId* it; ///< Current position
+			const EntityId* end; ///< End of the column
+		};
+
+		/** Runtime-arity counterpart of intersectN() e.g. for dynamic components
+		 * 
+		 * Uses the same max-skip galloping strategy over a span of cursors.
+		 * Cursors are advanced in place even on failure, where at least one has reached its end.
+		 * 
+		 * @param cursors Non-empty span of cursors, none at end (modified in place)
+		 * @return true if intersection found, false if any cursor reached end
+		 */
+		inline bool intersectRuntime(std::span<Cursor> cursors)
+		{
+			constexpr std::size_t GallopingThreshold = 32;
+
+			while (true)
+			{
+				EntityId maxId = *cursors[0].it;
+				for (const Cursor& cursor : cursors.subspan(1))
+				{
+					maxId = std::max(maxId, *cursor.it);
+				}
+
+				bool allAtMax = true;
+				for (Cursor& cursor : cursors)
+				{
+					if (!(*cursor.it < maxId))
+					{
+						continue;
+					}
+					allAtMax = false;
+
+					std::size_t linearCount = 0;
+					while (linearCount < GallopingThreshold && cursor.it != cursor.end && *cursor.it < maxId)
+					{
+						++cursor.it;
+						++linearCount;
+					}
+					if (cursor.it != cursor.end && *cursor.it < maxId)
+					{
+						cursor.it = std::lower_bound(cursor.it, cursor.end, maxId);
+					}
+					if (cursor.it == cursor.end)
+					{
+						return false;
+					}
+				}
+
+				if (allAtMax)
+				{
+					return true;
+				}
+			}
+		}
+
+		/** Runtime-arity counterpart of beginN()
+		 * @param cursors Non-empty span of cursors (modified in place on success)
+		 * @return true if at intersection, false if any cursor at end
+		 */
+		inline bool beginRuntime(std::span<Cursor> cursors)
+		{
+			for (const Cursor& cursor : cursors)
+			{
+				if (cursor.it == cursor.end)
+				{
+					return false;
+				}
+			}
+			return intersectRuntime(cursors);
+		}
+
+		/** Runtime-arity counterpart of incrementN()
+		 * @param cursors Non-empty span of cursors at an intersection (modified in place on success)
+		 * @return true if next intersection found, false if any cursor reached end
+		 */
+		inline bool incrementRuntime(std::span<Cursor> cursors)
+		{
+			for (Cursor& cursor : cursors)
+			{
+				if (++cursor.it == cursor.end)
+				{
+					return false;
+				}
+			}
+			return intersectRuntime(cursors);
+		}
+
+		/** Find the first position whose key is not less than value by galloping from a hint position.
+		 * 
+		 * Probes at exponentially growing distances forward (or backward) from the hint to bracket the
+		 * answer, then binary searches the bracket. Costs O(log d) where d is the distance from the hint,
+		 * so resuming a search near a previous position is cheap even after keys were inserted or removed.
+		 * 
+		 * @tparam Key Callable returning the EntityId at a position, keys must be ascending
+		 * @param size Number of positions
+		 * @param hint Position to start from, clamped to size
+		 * @param value EntityId to search for
+		 * @param key Key accessor
+		 * @return Position of the first key not less than value, or size if none
+		 */
+		template<typename Key>
+		std::size_t gallopLowerBound(std::size_t size, std::size_t hint, EntityId value, Key&& key)
+		{
+			hint = std::min(hint, size);
+			std::size_t low = 0;   // Answer is in [low, high]
+			std::size_t high = size;
+
+			if (hint < size && key(hint) < value)
+			{
+				// Gallop forward keeping key(low) < value
+				std::size_t step = 1;
+				low = hint + 1;
+				while (hint + step < size && key(hint + step) < value)
+				{
+					low = hint + step + 1;
+					step *= 2;
+				}
+				high = std::min(hint + step, size);
+			}
+			else
+			{
+				// Gallop backward keeping high == size or key(high) >= value
+				std::size_t step = 1;
+				high = hint;
+				while (high > 0)
+				{
+					const std::size_t probe = (high >= step) ? high - step : 0;
+					if (key(probe) < value)
+					{
+						low = probe + 1;
+						break;
+					}
+					high = probe;
+					step *= 2;
+				}
+			}
+
+			// Binary search the bracket
+			while (low < high)
+			{
+				const std::size_t mid = low + (high - low) / 2;
+				if (key(mid) < value)
+					low = mid + 1;
+				else
+					high = mid;
+			}
+			return low;
+		}
+
 	} // namespace Intersection
 } // namespace SubzeroECS
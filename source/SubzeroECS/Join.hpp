@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm> //< std::min
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility> //< std::index_sequence
+#include <vector>
+
+#include "Collection.hpp"
+#include "CollectionRegistry.hpp"
+#include "EntityId.hpp"
+#include "StaticWorld.hpp"
+#include "View.hpp"
+
+namespace SubzeroECS
+{
+	/** Join term naming the EntityId member of a component that references another entity
+	 * e.g. Via<&Target::id> follows Target::id to the referenced entity
+	 */
+	template< auto Member >
+	struct Via;
+
+	template< typename TOwner, EntityId TOwner::* Member >
+	struct Via< Member >
+	{
+		using Owner = TOwner; ///< Component holding the reference
+
+		static EntityId reference( const Owner& owner ) noexcept
+		{ return owner.*Member; }
+	};
+
+	template< typename ViaTerm, typename... Foreign >
+	class Join;
+
+	/** Iterates entities together with components of the entity they reference
+	 *
+	 * References are gathered a chunk at a time and resolved with one Collection::findMany() pass per
+	 * Foreign component, so following references costs a small sort and a forward merge per chunk
+	 * instead of a cold binary search per entity.
+	 * Entities whose referenced entity lacks any of the Foreign components are skipped.
+	 *
+	 * @tparam Member   EntityId member of the owner component to follow, as Via<&Owner::member>
+	 * @tparam Foreign  Components fetched from the referenced entity
+	 * @warning Foreign collections must not have entities added or removed during each()
+	 */
+	template< auto Member, typename... Foreign >
+	class Join< Via<Member>, Foreign... >
+	{
+	public:
+		using Owner = typename Via<Member>::Owner; ///< Component holding the reference
+		static constexpr std::size_t ChunkSize = 16384U; ///< References resolved per findMany() pass
+
+		Join( CollectionRegistry& registry )
+			: owner_( registry.get<Owner>() )
+			, foreign_( registry.get<Foreign>()... )
+		{}
+
+		template< typename... WorldComponents >
+		Join( StaticWorld<WorldComponents...>& world )
+			: owner_( world.template get<Owner>() )
+			, foreign_( world.template get<Foreign>()... )
+		{}
+
+		/** Invoke func(EntityId, Owner&, Foreign&...) for each entity with an Owner component */
+		template< typename Func >
+		void each( Func&& func )
+		{
+			const EntityId* const ids = owner_.ids().data();
+			auto& owners = owner_.components();
+			eachChunk( std::size_t{0U}, owner_.size()
+				, [&]( std::size_t i ) { return Via<Member>::reference( owners[i] ); }
+				, [&]( std::size_t i, Foreign&... foreign ) { func( ids[i], owners[i], foreign... ); } );
+		}
+
+		/** Invoke func(View::Iterator, Foreign&...) for each entity of a view
+		 * @param view  View that includes the Owner component e.g. View<Owner, Position, Velocity>
+		 */
+		template< typename... Components, typename Func >
+		void each( View<Components...>& view, Func&& func )
+		{
+			static_assert( (std::is_same_v<Owner, Components> || ...), "View must include the Via owner component" );
+			using Iterator = typename View<Components...>::Iterator;
+			eachChunk( view.begin(), view.end()
+				, []( const Iterator& iEntity ) { return Via<Member>::reference( iEntity.template get<Owner>() ); }
+				, [&]( const Iterator& iEntity, Foreign&... foreign ) { func( iEntity, foreign... ); } );
+		}
+
+	private:
+
+		/** Gather references of up to ChunkSize sources, resolve them in bulk and invoke the matches
+		 * @remark Every source has an Owner component so the chunk never needs to exceed the Owner count
+		 * @tparam Source  Owner index or View iterator
+		 */
+		template< typename Source, typename Reference, typename Invoke >
+		void eachChunk( Source iSource, const Source iEnd, Reference&& reference, Invoke&& invoke )
+		{
+			const std::size_t chunkSize = std::min( ChunkSize, owner_.size() );
+			std::vector<Source> sources;
+			sources.reserve( chunkSize );
+			std::vector<EntityId> references;
+			references.reserve( chunkSize );
+			std::tuple< std::vector<Foreign*>... > resolved;
+			std::apply( [chunkSize]( auto&... components ) { (components.resize( chunkSize ), ...); }, resolved );
+
+			while ( iSource != iEnd )
+			{
+				sources.clear();
+				references.clear();
+				for ( ; iSource != iEnd && sources.size() != chunkSize; ++iSource )
+				{
+					sources.push_back( iSource );
+					references.push_back( reference( iSource ) );
+				}
+				invokeChunk( sources, references, resolved, invoke, std::index_sequence_for<Foreign...>{} );
+			}
+		}
+
+		template< typename Source, typename Resolved, typename Invoke, std::size_t... Is >
+		void invokeChunk( const std::vector<Source>& sources, const std::vector<EntityId>& references
+			, Resolved& resolved, Invoke& invoke, std::index_sequence<Is...> )
+		{
+			(std::get<Is>(foreign_).findMany( references, std::get<Is>(resolved) ), ...);
+			for ( std::size_t i = 0U; i != sources.size(); ++i )
+			{
+				if ( ((std::get<Is>(resolved)[i] != nullptr) && ...) )
+					invoke( sources[i], *std::get<Is>(resolved)[i]... );
+			}
+		}
+
+	private:
+		Collection<Owner>& owner_; //< Components holding the references
+		std::tuple< Collection<Foreign>&... > foreign_; //< Components of referenced entities
+	};
+
+} //END: SubzeroECS
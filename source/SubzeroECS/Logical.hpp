@@ -11,6 +11,8 @@ namespace SubzeroECS
 	struct Has : Query
 	{
 		typedef Component Component_t;
+		typedef std::tuple<Component> Components_t;
+		static constexpr bool IdsOnly = true; ///< @see QueryIdsOnly
 		constexpr bool operator() (const Entity& Entity) const
 		{ return has<Component>(Entity); }
 	};
@@ -22,6 +24,7 @@ namespace SubzeroECS
 	struct Find : Query
 	{
 		typedef Component Component_t;
+		typedef std::tuple<Component> Components_t;
 		constexpr Component* operator() (const Entity& Entity) const
 		{ return find<Component>(Entity); }
 	};
@@ -31,6 +34,9 @@ namespace SubzeroECS
 	template<class Lhs, class Rhs>
 	struct AndOp : Query
 	{
+		typedef decltype(std::tuple_cat( std::declval<QueryComponents_t<Lhs>>(), std::declval<QueryComponents_t<Rhs>>() )) Components_t;
+		static constexpr bool IdsOnly = QueryIdsOnly<Lhs>::value && QueryIdsOnly<Rhs>::value; ///< @see QueryIdsOnly
+
 		AndOp( const Lhs& lhs, const Rhs& rhs ) : lhs_(lhs), rhs_(rhs) {}
 		constexpr bool operator() (const Entity& entity) const
 		{ 
@@ -53,6 +59,8 @@ namespace SubzeroECS
 	template<class Lhs, class Value>
 	struct QueryValueOp : Query
 	{
+		typedef QueryComponents_t<Lhs> Components_t;
+
 		QueryValueOp( const Lhs& lhs, const Value& value ) : lhs_(lhs), value_(value) {}
 	protected:
 		const Lhs lhs_;
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility> //< std::move, std::index_sequence
+
+#include "Collection.hpp"
+#include "EntityId.hpp"
+
+namespace SubzeroECS
+{
+	/** Template entity recording a component set once for spawning many copies
+	 * @code
+	 * const Prefab projectile( Position{}, Velocity{ 0.0F, 10.0F }, Lifetime{ 2.0F } );
+	 * world.instantiate( projectile, 10000U, []( EntityId, Position& position, Velocity&, Lifetime& ) { ... } );
+	 * @endcode
+	 * @see World::instantiate(), StaticWorld::instantiate()
+	 *
+	 * @tparam Components  Components given to every instance, copied from the prefab
+	 */
+	template< typename... Components >
+	class Prefab
+	{
+	public:
+		explicit Prefab( Components... components )
+			: components_( std::move(components)... )
+		{}
+
+		/// Component value copied to instances
+		template< typename Component >
+		Component& get() noexcept
+		{ return std::get<Component>(components_); }
+
+		template< typename Component >
+		const Component& get() const noexcept
+		{ return std::get<Component>(components_); }
+
+	private:
+		std::tuple<Components...> components_; //< Component values of the template entity
+	};
+
+	namespace Detail
+	{
+		template< typename... Components, typename InitFn, std::size_t... Is >
+		void initPrefab( EntityRange entities, InitFn& init, const std::array<std::size_t, sizeof...(Components)>& starts
+			, std::index_sequence<Is...>, Collection<Components>&... collections )
+		{
+			for ( std::size_t i = 0U; i < entities.count; ++i )
+				init( entities[i], collections.components()[starts[Is] + i]... );
+		}
+
+		/** Fill the collections of a prefab for a block of new entities then call init for each instance
+		 * @param init  Called as init(EntityId, Components&...) in id order
+		 */
+		template< typename... Components, typename InitFn >
+		void instantiatePrefab( const Prefab<Components...>& prefab, EntityRange entities, InitFn& init, Collection<Components>&... collections )
+		{
+			const std::array<std::size_t, sizeof...(Components)> starts{ collections.createRange( entities, prefab.template get<Components>() )... };
+			initPrefab( entities, init, starts, std::index_sequence_for<Components...>{}, collections... );
+		}
+	} //END: Detail
+
+} //END: SubzeroECS
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cassert>
+#include <tuple>
+#include <type_traits>
+#include <utility> //< std::declval
 
 #include "Entity.hpp"
 
@@ -17,6 +20,39 @@ namespace SubzeroECS
 		: std::is_base_of<Query, T> 
 	{};
 	
+	/* Components an entity is required to have for a query to match
+	@remark Queries declaring no Components_t may match entities without any component
+	*/
+	template<typename QueryObject>
+	struct QueryComponents
+	{
+		typedef std::tuple<> type;
+	};
+
+	template<typename QueryObject>
+		requires requires { typename QueryObject::Components_t; }
+	struct QueryComponents<QueryObject>
+	{
+		typedef typename QueryObject::Components_t type;
+	};
+
+	template<typename QueryObject>
+	using QueryComponents_t = typename QueryComponents<QueryObject>::type;
+
+	/* Query matching exactly the entities that have all of its QueryComponents_t e.g. Has<A>() && Has<B>()
+	@remark Such queries are resolved by intersecting collection ids without evaluating entities
+	*/
+	template<typename QueryObject>
+	struct QueryIdsOnly
+		: std::false_type
+	{};
+
+	template<typename QueryObject>
+		requires requires { QueryObject::IdsOnly; }
+	struct QueryIdsOnly<QueryObject>
+		: std::bool_constant<QueryObject::IdsOnly>
+	{};
+
 	/* Query operator function
 	*/
 	template<class QueryObject >
@@ -0,0 +1,412 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <map>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility> //< std::move
+#include <vector>
+
+#include "Collection.hpp"
+#include "CollectionRegistry.hpp"
+#include "EntityId.hpp"
+#include "System.hpp" //< SliceBudget
+
+namespace SubzeroECS
+{
+	/** Serialized region layout, all values in native byte order
+	 * @code
+	 * RegionHeader
+	 * for each component type in order:
+	 *     RegionColumnHeader
+	 *     std::uint32_t localIndex[count]   ///< Ascending entity index within the region
+	 *     std::byte     components[count * elementSize]
+	 * @endcode
+	 */
+	struct RegionHeader
+	{
+		static constexpr std::uint32_t Magic = 0x4745525AU; ///< 'ZREG'
+		static constexpr std::uint32_t CurrentVersion = 1U;
+
+		std::uint32_t magic = Magic;
+		std::uint32_t version = CurrentVersion;
+		std::uint32_t entityCount = 0U; ///< Entities of the region
+		std::uint32_t columnCount = 0U; ///< Component columns that follow
+	};
+
+	/** Header of a component column of a serialized region */
+	struct RegionColumnHeader
+	{
+		std::uint32_t elementSize = 0U; ///< sizeof(Component), checked on decode
+		std::uint32_t count = 0U; ///< Entities of the region with this component
+	};
+
+	/** Decoded components of one type waiting to be spliced into a collection */
+	template< typename Component >
+	struct RegionColumn
+	{
+		std::vector<std::uint32_t> localIndices; ///< Ascending entity index within the region
+		std::vector<Component> components; ///< components[i] belongs to entity localIndices[i]
+	};
+
+	/** Staging columns of a decoded region */
+	template< typename... Components >
+	struct RegionColumns
+	{
+		std::uint32_t entityCount = 0U; ///< Entities of the region
+		std::tuple< RegionColumn<Components>... > columns; ///< Column per component type
+	};
+
+	namespace Detail
+	{
+		/** Collection of a World or StaticWorld */
+		template< typename Component, typename WorldType >
+		Collection<Component>& regionCollection( WorldType& world )
+		{
+			if constexpr ( std::is_base_of_v<CollectionRegistry, WorldType> )
+				return static_cast<CollectionRegistry&>(world).template get<Component>();
+			else
+				return world.template get<Component>();
+		}
+
+		inline void appendBytes( std::vector<std::byte>& bytes, const void* data, std::size_t size )
+		{
+			const std::byte* begin = static_cast<const std::byte*>( data );
+			bytes.insert( bytes.end(), begin, begin + size );
+		}
+
+		/** Copy the next size bytes of a region out and advance past them */
+		inline void readBytes( std::span<const std::byte>& bytes, void* data, std::size_t size )
+		{
+			if ( bytes.size() < size )
+				throw std::invalid_argument( "Truncated region for call to decodeRegion()" );
+			if ( size != 0U )
+				std::memcpy( data, bytes.data(), size );
+			bytes = bytes.subspan( size );
+		}
+
+		template< typename Component, typename WorldType >
+		void encodeColumn( std::vector<std::byte>& bytes, WorldType& world, std::span<const EntityId> entityIds )
+		{
+			std::vector<Component*> found( entityIds.size() );
+			regionCollection<Component>( world ).findMany( entityIds, found );
+
+			RegionColumnHeader header{ static_cast<std::uint32_t>( sizeof(Component) ), 0U };
+			std::vector<std::uint32_t> localIndices;
+			for ( std::size_t i = 0U; i < found.size(); ++i )
+			{
+				if ( found[i] != nullptr )
+					localIndices.push_back( static_cast<std::uint32_t>(i) );
+			}
+			header.count = static_cast<std::uint32_t>( localIndices.size() );
+
+			appendBytes( bytes, &header, sizeof(header) );
+			appendBytes( bytes, localIndices.data(), localIndices.size() * sizeof(std::uint32_t) );
+			for ( const std::uint32_t localIndex : localIndices )
+				appendBytes( bytes, found[localIndex], sizeof(Component) );
+		}
+
+		template< typename Component >
+		void decodeColumn( std::span<const std::byte>& bytes, std::uint32_t entityCount, RegionColumn<Component>& column )
+		{
+			RegionColumnHeader header;
+			readBytes( bytes, &header, sizeof(header) );
+			if ( header.elementSize != sizeof(Component) || header.count > entityCount )
+				throw std::invalid_argument( "Region column does not match the component type for call to decodeRegion()" );
+
+			column.localIndices.resize( header.count );
+			readBytes( bytes, column.localIndices.data(), header.count * sizeof(std::uint32_t) );
+			for ( std::size_t i = 0U; i < column.localIndices.size(); ++i )
+			{
+				if ( column.localIndices[i] >= entityCount || (i != 0U && column.localIndices[i] <= column.localIndices[i - 1U]) )
+					throw std::invalid_argument( "Region column indices are not ascending for call to decodeRegion()" );
+			}
+
+			column.components.resize( header.count );
+			readBytes( bytes, column.components.data(), header.count * sizeof(Component) );
+		}
+	} //END: Detail
+
+	/** Serialize the components of entities of a world as a region
+	 * @param entityIds  Ids sorted ascending, entity i of the region is entityIds[i]
+	 */
+	template< typename... Components, typename WorldType >
+	std::vector<std::byte> encodeRegion( WorldType& world, std::span<const EntityId> entityIds )
+	{
+		static_assert( (std::is_trivially_copyable_v<Components> && ...), "Region components are serialized with memcpy" );
+		std::vector<std::byte> bytes;
+		const RegionHeader header{ RegionHeader::Magic, RegionHeader::CurrentVersion
+			, static_cast<std::uint32_t>( entityIds.size() ), static_cast<std::uint32_t>( sizeof...(Components) ) };
+		Detail::appendBytes( bytes, &header, sizeof(header) );
+		(Detail::encodeColumn<Components>( bytes, world, entityIds ), ...);
+		return bytes;
+	}
+
+	/** Decode a serialized region into staging columns, safe to call from any thread
+	 * @throw std::invalid_argument if the bytes are not a region of these component types
+	 */
+	template< typename... Components >
+	RegionColumns<Components...> decodeRegion( std::span<const std::byte> bytes )
+	{
+		static_assert( (std::is_trivially_copyable_v<Components> && ...), "Region components are serialized with memcpy" );
+		RegionHeader header;
+		Detail::readBytes( bytes, &header, sizeof(header) );
+		if ( header.magic != RegionHeader::Magic || header.version != RegionHeader::CurrentVersion || header.columnCount != sizeof...(Components) )
+			throw std::invalid_argument( "Unsupported region for call to decodeRegion()" );
+
+		RegionColumns<Components...> region;
+		region.entityCount = header.entityCount;
+		std::apply( [&]( RegionColumn<Components>&... columns )
+		{
+			(Detail::decodeColumn( bytes, header.entityCount, columns ), ...);
+		}, region.columns );
+		return region;
+	}
+
+	/** Streams serialized regions of entities into and out of a live world
+	 *
+	 * load() decodes a region on a background thread into staging columns. update() then splices the
+	 * decoded columns into the live collections in bounded slices on the calling thread: each region is
+	 * given a consecutive range of new ids, so its components are appended to the collections in chunks
+	 * by Collection::createMany() rather than inserted one entity at a time. unload() drops all components
+	 * of a region's entities with one Collection::removeMany() pass per collection.
+	 * @code
+	 * RegionStreamer< StaticWorld<Position, Mesh>, Position, Mesh > streamer( world );
+	 * const auto region = streamer.load( readFile( "cell_12_7.region" ) );
+	 * streamer.update( SliceBudget{ .maxDuration = std::chrono::microseconds(500) } ); // Every frame
+	 * streamer.unload( region );
+	 * @endcode
+	 * @warning Entities spliced part way through a region are visible to systems before the region is loaded
+	 *
+	 * @tparam WorldType   World or StaticWorld the regions stream into
+	 * @tparam Components  Component types stored in the regions, all trivially copyable
+	 */
+	template< typename WorldType, typename... Components >
+	class RegionStreamer
+	{
+	public:
+		using RegionId = std::uint32_t;
+		using Columns = RegionColumns<Components...>;
+
+		/// Components spliced per Collection::createMany() call, time budgets are checked between chunks
+		static constexpr std::size_t ChunkSize = 1024U;
+
+		explicit RegionStreamer( WorldType& world )
+			: world_(&world)
+		{}
+
+		RegionStreamer( const RegionStreamer& ) = delete;
+		RegionStreamer& operator=( const RegionStreamer& ) = delete;
+
+		/** Start decoding a serialized region on a background thread
+		 * @return Id of the region to pass to unload()
+		 */
+		RegionId load( std::vector<std::byte> bytes )
+		{
+			const RegionId regionId = nextRegionId_++;
+			Region& region = regions_[regionId];
+			region.decoding = std::async( std::launch::async, []( std::vector<std::byte> data )
+			{
+				return decodeRegion<Components...>( data );
+			}, std::move(bytes) );
+			return regionId;
+		}
+
+		/** Splice decoded regions into the world within a budget, oldest region first
+		 * @param budget  Limits the components spliced and the time taken, checked every ChunkSize components
+		 * @return Number of components spliced
+		 * @throw std::invalid_argument if a region failed to decode, the region is discarded
+		 */
+		std::size_t update( const SliceBudget& budget = {} )
+		{
+			const auto start = std::chrono::steady_clock::now();
+			std::size_t spliced = 0U;
+
+			for ( auto iRegion = regions_.begin(); iRegion != regions_.end(); )
+			{
+				Region& region = iRegion->second;
+				if ( region.decoding.valid() )
+				{
+					if ( region.decoding.wait_for( std::chrono::seconds(0) ) != std::future_status::ready )
+					{
+						++iRegion;
+						continue;
+					}
+					bool promoted = false;
+					try
+					{
+						promoted = promote( region );
+					}
+					catch ( ... )
+					{
+						regions_.erase( iRegion );
+						throw;
+					}
+					if ( !promoted )
+					{
+						iRegion = regions_.erase( iRegion ); //< Unloaded while decoding
+						continue;
+					}
+				}
+
+				while ( !region.loaded() )
+				{
+					// At least one chunk is spliced per update so streaming always progresses
+					if ( spliced >= budget.maxEntities || (spliced != 0U && budget.expired( start )) )
+						return spliced;
+					spliced += spliceChunk( region, std::min( ChunkSize, budget.maxEntities - spliced ) );
+				}
+				++iRegion;
+			}
+			return spliced;
+		}
+
+		/** Remove every component of the region's entities from the world
+		 * A region still decoding is discarded once its decode finishes
+		 * @return false if the region is unknown
+		 */
+		bool unload( RegionId regionId )
+		{
+			auto iRegion = regions_.find( regionId );
+			if ( iRegion == regions_.end() )
+				return false;
+
+			Region& region = iRegion->second;
+			if ( region.decoding.valid() )
+			{
+				region.cancelled = true; //< Dropping the future here would block on the decode
+				return true;
+			}
+
+			std::vector<EntityId> entityIds( region.entities.count );
+			for ( std::size_t i = 0U; i < entityIds.size(); ++i )
+				entityIds[i] = EntityId{ static_cast<std::uint32_t>( region.entities.first.value + i ) };
+			(Detail::regionCollection<Components>( *world_ ).removeMany( entityIds ), ...);
+			regions_.erase( iRegion );
+			return true;
+		}
+
+		/// True once every component of the region has been spliced into the world
+		bool isLoaded( RegionId regionId ) const
+		{
+			const auto iRegion = regions_.find( regionId );
+			return iRegion != regions_.end() && !iRegion->second.decoding.valid() && iRegion->second.loaded();
+		}
+
+		/// Ids given to the entities of a region, empty until the region has decoded
+		EntityRange entities( RegionId regionId ) const
+		{
+			const auto iRegion = regions_.find( regionId );
+			return (iRegion != regions_.end()) ? iRegion->second.entities : EntityRange{};
+		}
+
+		/// Number of regions decoding or waiting to be spliced
+		std::size_t pendingCount() const noexcept
+		{
+			return static_cast<std::size_t>( std::count_if( regions_.begin(), regions_.end(), []( const auto& entry )
+			{
+				return entry.second.decoding.valid() || !entry.second.loaded();
+			}) );
+		}
+
+	private:
+		/** Region streaming into the world */
+		struct Region
+		{
+			std::future<Columns> decoding; ///< Valid until the decoded columns are taken
+			Columns staging; ///< Decoded columns, moved from as they are spliced
+			EntityRange entities; ///< Ids of the region's entities
+			std::size_t column = 0U; ///< Column being spliced
+			std::size_t offset = 0U; ///< Components of the column already spliced
+			bool cancelled = false; ///< Unloaded while decoding
+
+			bool loaded() const noexcept
+			{ return column == sizeof...(Components); }
+		};
+
+		/** Take the decoded columns of a region and give its entities ids
+		 * @return false if the region was cancelled
+		 * @throw The exception of a failed decode
+		 */
+		bool promote( Region& region )
+		{
+			Columns staging = region.decoding.get();
+			if ( region.cancelled )
+				return false;
+
+			region.staging = std::move(staging);
+			region.entities = EntityRange{ world_->createRange( region.staging.entityCount ), region.staging.entityCount };
+			skipEmptyColumns( region );
+			return true;
+		}
+
+		/** Splice up to count components of the current column
+		 * @return Number of components spliced
+		 */
+		std::size_t spliceChunk( Region& region, std::size_t count )
+		{
+			std::size_t spliced = 0U;
+			visitColumn( region, [&]( auto& column, auto& collection )
+			{
+				const std::size_t end = std::min( column.components.size(), region.offset + count );
+				chunkIds_.resize( end - region.offset );
+				for ( std::size_t i = region.offset; i < end; ++i )
+					chunkIds_[i - region.offset] = EntityId{ region.entities.first.value + column.localIndices[i] };
+
+				collection.createMany( chunkIds_, std::span( column.components ).subspan( region.offset, end - region.offset ) );
+				spliced = end - region.offset;
+				region.offset = end;
+			});
+			skipEmptyColumns( region );
+			return spliced;
+		}
+
+		/** Advance past columns that are fully spliced, releasing their staging memory */
+		void skipEmptyColumns( Region& region )
+		{
+			while ( !region.loaded() )
+			{
+				bool done = false;
+				visitColumn( region, [&]( auto& column, auto& )
+				{
+					done = region.offset == column.components.size();
+					if ( done )
+						column = {};
+				});
+				if ( !done )
+					return;
+				++region.column;
+				region.offset = 0U;
+			}
+		}
+
+		/** Call func(column, collection) for the column being spliced */
+		template< typename Func >
+		void visitColumn( Region& region, Func&& func )
+		{
+			visitColumn( region, func, std::index_sequence_for<Components...>{} );
+		}
+
+		template< typename Func, std::size_t... Indices >
+		void visitColumn( Region& region, Func& func, std::index_sequence<Indices...> )
+		{
+			((region.column == Indices
+				? func( std::get<Indices>( region.staging.columns ), Detail::regionCollection<Components>( *world_ ) )
+				: void()), ...);
+		}
+
+	private:
+		WorldType* world_; //< World the regions stream into
+		std::map<RegionId, Region> regions_; //< Regions by id, in load order
+		RegionId nextRegionId_ = 0U; //< Id of the next loaded region
+		std::vector<EntityId> chunkIds_; //< Ids of the chunk being spliced
+	};
+
+} //END: SubzeroECS
@@ -0,0 +1,417 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional> //< std::less etc
+#include <numeric> //< std::iota
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility> //< std::move
+#include <vector>
+
+#include "DynamicCollection.hpp"
+#include "EntityId.hpp"
+#include "Intersection.hpp"
+
+namespace SubzeroECS
+{
+	/** Comparison of a field predicate as `field op value` */
+	enum class CompareOp : std::uint8_t
+	{
+		Less,
+		LessEqual,
+		Greater,
+		GreaterEqual,
+		Equal,
+		NotEqual,
+	};
+
+	/** Query over dynamic components built at runtime e.g. by tools and scripts
+	 * The runtime counterpart of the Logical.hpp expression templates, limited to a conjunction of terms.
+	 * @code
+	 * RuntimeQuery query;
+	 * query.where( health, "value", CompareOp::Less, 10.0 ).where( team, "id", CompareOp::Equal, 2.0 );
+	 * cache.plan( query ).each( []( EntityId entityId ) { ... } );
+	 * @endcode
+	 */
+	class RuntimeQuery
+	{
+	public:
+		/** Field predicate of a term */
+		struct Predicate
+		{
+			DynamicComponentId component; ///< Component holding the field
+			std::string field; ///< Field name, @see ComponentLayout::findField()
+			CompareOp op; ///< Comparison
+			double value; ///< Value compared against, fields are widened to double
+
+			friend bool operator<( const Predicate& lhs, const Predicate& rhs ) noexcept
+			{ return std::tie( lhs.component, lhs.field, lhs.op, lhs.value ) < std::tie( rhs.component, rhs.field, rhs.op, rhs.value ); }
+		};
+
+		/** Require the entities to have a component */
+		RuntimeQuery& with( DynamicComponentId component )
+		{
+			const auto iFind = std::lower_bound( components_.begin(), components_.end(), component );
+			if ( iFind == components_.end() || *iFind != component )
+				components_.insert( iFind, component );
+			return *this;
+		}
+
+		/** Require the entities to have a component whose field compares true against a value */
+		RuntimeQuery& where( DynamicComponentId component, std::string field, CompareOp op, double value )
+		{
+			with( component );
+			predicates_.push_back( Predicate{ component, std::move(field), op, value } );
+			return *this;
+		}
+
+		/// Required components sorted ascending
+		const std::vector<DynamicComponentId>& components() const noexcept
+		{ return components_; }
+
+		/// Field predicates in the order they were added
+		const std::vector<Predicate>& predicates() const noexcept
+		{ return predicates_; }
+
+		/** Canonical text of the query, equal for queries with the same terms in any order
+		 * @see QueryPlanCache
+		 */
+		std::string signature() const
+		{
+			std::vector<Predicate> predicates = predicates_;
+			std::sort( predicates.begin(), predicates.end() );
+
+			std::ostringstream text;
+			text << std::hexfloat; //< Exact values
+			for ( const DynamicComponentId component : components_ )
+				text << 'c' << component << ';';
+			for ( const Predicate& predicate : predicates )
+				text << 'p' << predicate.component << '.' << predicate.field << ':' << int(predicate.op) << ':' << predicate.value << ';';
+			return text.str();
+		}
+
+	private:
+		std::vector<DynamicComponentId> components_; //< Required components, sorted
+		std::vector<Predicate> predicates_; //< Field predicates
+	};
+
+	/** Compiled RuntimeQuery resolved against a DynamicComponentRegistry
+	 *
+	 * Every execution orders the terms by selectivity from the current collection sizes:
+	 * - Predicates of a term no more than ScanRatio times larger than the smallest term are evaluated first
+	 *   as a branch-free scan of the field column into a mask, which compacts to the matching ids.
+	 * - Predicates of larger terms are probed only for the entities that survive the intersection.
+	 * The id lists are then intersected smallest first with the runtime-arity Intersection::beginRuntime().
+	 * @warning References the collections of the registry, which must outlive the plan
+	 */
+	class QueryPlan
+	{
+	public:
+		/// Predicate columns up to this many times the smallest term are scanned, larger columns are probed
+		static constexpr std::size_t ScanRatio = 4U;
+
+		/** How a term takes part in an execution, @see explain() */
+		enum class Strategy : std::uint8_t
+		{
+			Has, ///< Id column intersected as is
+			Scan, ///< Predicates scanned over the column before intersecting
+			Probe, ///< Predicates tested per intersected entity
+		};
+
+		/** Term of an execution in intersection order */
+		struct Step
+		{
+			DynamicComponentId component; ///< Component of the term
+			Strategy strategy; ///< How the term is evaluated
+			std::size_t rows; ///< Ids intersected, after filtering for Scan terms
+		};
+
+		/** @throw std::invalid_argument if a component, field or field type of the query is not known */
+		QueryPlan( DynamicComponentRegistry& registry, const RuntimeQuery& query )
+		{
+			terms_.reserve( query.components().size() );
+			for ( const DynamicComponentId component : query.components() )
+				terms_.push_back( Term{ &registry.get( component ), {}, Strategy::Has, {} } );
+
+			for ( const RuntimeQuery::Predicate& predicate : query.predicates() )
+			{
+				Term& term = *std::find_if( terms_.begin(), terms_.end(), [&]( const Term& candidate )
+				{
+					return candidate.collection->componentId() == predicate.component;
+				});
+				const ComponentLayout& layout = term.collection->layout();
+				const ComponentField* field = layout.findField( predicate.field );
+				if ( field == nullptr || field->type == FieldType::Unknown )
+					throw std::invalid_argument( "No typed field " + predicate.field + " of dynamic component " + layout.name + " for RuntimeQuery" );
+				term.predicates.push_back( CompiledPredicate{ field->offset, field->type, predicate.op, predicate.value } );
+			}
+		}
+
+		/** Invoke func(EntityId) for every matching entity in ascending id order */
+		template< typename Func >
+		void each( Func&& func )
+		{
+			if ( !prepare() )
+				return;
+
+			bool found = Intersection::beginRuntime( cursors_ );
+			while ( found )
+			{
+				if ( probe() )
+					func( *cursors_[0].it );
+				found = Intersection::incrementRuntime( cursors_ );
+			}
+		}
+
+		/** Number of matching entities */
+		std::size_t count()
+		{
+			std::size_t result = 0U;
+			each( [&result]( EntityId ) { ++result; } );
+			return result;
+		}
+
+		/** Ids of the matching entities in ascending order */
+		std::vector<EntityId> entities()
+		{
+			std::vector<EntityId> result;
+			each( [&result]( EntityId entityId ) { result.push_back( entityId ); } );
+			return result;
+		}
+
+		/** Terms in the order the next execution would intersect them */
+		std::vector<Step> explain()
+		{
+			std::vector<Step> steps;
+			prepare();
+			for ( const std::size_t iTerm : order_ )
+			{
+				const Term& term = terms_[iTerm];
+				steps.push_back( Step{ term.collection->componentId(), term.strategy, rows( term ) } );
+			}
+			return steps;
+		}
+
+	private:
+		/** Predicate with its field resolved to an offset */
+		struct CompiledPredicate
+		{
+			std::uint32_t offset; ///< Byte offset of the field
+			FieldType type; ///< Type of the field
+			CompareOp op; ///< Comparison
+			double value; ///< Value compared against
+		};
+
+		/** Collection of the query and its predicates */
+		struct Term
+		{
+			DynamicCollection* collection; ///< Collection of the component
+			std::vector<CompiledPredicate> predicates; ///< Predicates on fields of the component
+			Strategy strategy; ///< Strategy of the current execution
+			std::vector<EntityId> filtered; ///< Ids passing the predicates of a Scan term
+		};
+
+		static std::size_t rows( const Term& term ) noexcept
+		{ return (term.strategy == Strategy::Scan) ? term.filtered.size() : term.collection->size(); }
+
+		/** Choose term strategies, scan predicate columns and order the cursors by selectivity
+		@return false if no entity can match
+		*/
+		bool prepare()
+		{
+			cursors_.clear();
+			order_.resize( terms_.size() );
+			if ( terms_.empty() )
+				return false;
+
+			std::size_t smallest = terms_[0].collection->size();
+			for ( const Term& term : terms_ )
+				smallest = std::min( smallest, term.collection->size() );
+
+			for ( Term& term : terms_ )
+			{
+				if ( term.predicates.empty() )
+					term.strategy = Strategy::Has;
+				else if ( term.collection->size() <= smallest * ScanRatio )
+				{
+					term.strategy = Strategy::Scan;
+					scan( term );
+				}
+				else
+					term.strategy = Strategy::Probe;
+			}
+
+			std::iota( order_.begin(), order_.end(), std::size_t(0U) );
+			std::stable_sort( order_.begin(), order_.end(), [this]( std::size_t lhs, std::size_t rhs )
+			{
+				return rows( terms_[lhs] ) < rows( terms_[rhs] );
+			});
+
+			for ( const std::size_t iTerm : order_ )
+			{
+				const Term& term = terms_[iTerm];
+				const std::vector<EntityId>& ids = (term.strategy == Strategy::Scan) ? term.filtered : term.collection->ids();
+				cursors_.push_back( Intersection::Cursor{ ids.data(), ids.data() + ids.size() } );
+			}
+			return true;
+		}
+
+		/** Filter the ids of a term by a branch-free scan of each predicate field column */
+		void scan( Term& term )
+		{
+			DynamicCollection& collection = *term.collection;
+			const std::size_t count = collection.size();
+			mask_.assign( count, std::uint8_t(1U) );
+			for ( const CompiledPredicate& predicate : term.predicates )
+			{
+				const std::byte* field = collection.data() + predicate.offset;
+				const std::size_t stride = collection.layout().size;
+				switch ( predicate.type )
+				{
+				case FieldType::Int32: scanField<std::int32_t>( field, stride, count, predicate ); break;
+				case FieldType::UInt32: scanField<std::uint32_t>( field, stride, count, predicate ); break;
+				case FieldType::Float32: scanField<float>( field, stride, count, predicate ); break;
+				case FieldType::Float64: scanField<double>( field, stride, count, predicate ); break;
+				default: break;
+				}
+			}
+
+			// Compact without branching on the mask
+			const std::vector<EntityId>& ids = collection.ids();
+			term.filtered.resize( count );
+			std::size_t passed = 0U;
+			for ( std::size_t i = 0U; i < count; ++i )
+			{
+				term.filtered[passed] = ids[i];
+				passed += mask_[i];
+			}
+			term.filtered.resize( passed );
+		}
+
+		template< typename T >
+		void scanField( const std::byte* field, std::size_t stride, std::size_t count, const CompiledPredicate& predicate )
+		{
+			std::uint8_t* const mask = mask_.data();
+			const double value = predicate.value;
+			auto compare = [&]( auto op )
+			{
+				for ( std::size_t i = 0U; i < count; ++i )
+				{
+					T item;
+					std::memcpy( &item, field + i * stride, sizeof(T) );
+					mask[i] &= std::uint8_t( op( static_cast<double>(item), value ) );
+				}
+			};
+
+			switch ( predicate.op )
+			{
+			case CompareOp::Less: compare( std::less<double>{} ); break;
+			case CompareOp::LessEqual: compare( std::less_equal<double>{} ); break;
+			case CompareOp::Greater: compare( std::greater<double>{} ); break;
+			case CompareOp::GreaterEqual: compare( std::greater_equal<double>{} ); break;
+			case CompareOp::Equal: compare( std::equal_to<double>{} ); break;
+			case CompareOp::NotEqual: compare( std::not_equal_to<double>{} ); break;
+			}
+		}
+
+		/** Test the predicates of Probe terms for the entity at the cursors */
+		bool probe() const
+		{
+			for ( std::size_t iCursor = 0U; iCursor < order_.size(); ++iCursor )
+			{
+				const Term& term = terms_[order_[iCursor]];
+				if ( term.strategy != Strategy::Probe )
+					continue;
+
+				const std::size_t index = static_cast<std::size_t>( cursors_[iCursor].it - term.collection->ids().data() );
+				const std::byte* component = term.collection->at( index );
+				for ( const CompiledPredicate& predicate : term.predicates )
+				{
+					if ( !test( component + predicate.offset, predicate ) )
+						return false;
+				}
+			}
+			return true;
+		}
+
+		static bool test( const std::byte* field, const CompiledPredicate& predicate )
+		{
+			double item = 0.0;
+			switch ( predicate.type )
+			{
+			case FieldType::Int32: item = load<std::int32_t>( field ); break;
+			case FieldType::UInt32: item = load<std::uint32_t>( field ); break;
+			case FieldType::Float32: item = load<float>( field ); break;
+			case FieldType::Float64: item = load<double>( field ); break;
+			default: return false;
+			}
+
+			switch ( predicate.op )
+			{
+			case CompareOp::Less: return item < predicate.value;
+			case CompareOp::LessEqual: return item <= predicate.value;
+			case CompareOp::Greater: return item > predicate.value;
+			case CompareOp::GreaterEqual: return item >= predicate.value;
+			case CompareOp::Equal: return item == predicate.value;
+			case CompareOp::NotEqual: return item != predicate.value;
+			}
+			return false;
+		}
+
+		template< typename T >
+		static double load( const std::byte* field ) noexcept
+		{
+			T item;
+			std::memcpy( &item, field, sizeof(T) );
+			return static_cast<double>(item);
+		}
+
+	private:
+		std::vector<Term> terms_; //< Terms by ascending component id
+		std::vector<std::size_t> order_; //< Term index of each cursor
+		std::vector<Intersection::Cursor> cursors_; //< Id cursors smallest first
+		std::vector<std::uint8_t> mask_; //< Scan results of the term being scanned
+	};
+
+	/** Cache of compiled QueryPlans keyed by RuntimeQuery::signature()
+	 * Lets scripts rebuild the same query every frame without recompiling it.
+	 */
+	class QueryPlanCache
+	{
+	public:
+		explicit QueryPlanCache( DynamicComponentRegistry& registry )
+			: registry_( &registry )
+		{}
+
+		/** Get the plan of a query, compiling it on first use
+		 * @throw std::invalid_argument if the query does not compile, @see QueryPlan
+		 */
+		QueryPlan& plan( const RuntimeQuery& query )
+		{
+			std::string signature = query.signature();
+			const auto iFind = plans_.find( signature );
+			if ( iFind != plans_.end() )
+				return iFind->second;
+			return plans_.try_emplace( std::move(signature), *registry_, query ).first->second;
+		}
+
+		/// Number of cached plans
+		std::size_t size() const noexcept
+		{ return plans_.size(); }
+
+		/** Drop all cached plans e.g. after component types were unregistered */
+		void clear() noexcept
+		{ plans_.clear(); }
+
+	private:
+		DynamicComponentRegistry* registry_; //< Registry plans are compiled against
+		std::unordered_map<std::string, QueryPlan> plans_; //< Compiled plans by query signature
+	};
+
+} //END: SubzeroECS
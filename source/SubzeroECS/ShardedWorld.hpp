@@ -0,0 +1,289 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <utility> //< std::move
+#include <vector>
+
+#include "EntityId.hpp"
+#include "WorldGroup.hpp"
+
+namespace SubzeroECS
+{
+	/** World partitioned into shards by a spatial key, each shard stepped by its own thread
+	 *
+	 * Entities live in exactly one shard, a StaticWorld of a WorldGroup, so systems run per shard in
+	 * parallel and structural changes within a shard need no synchronisation. Entities crossing a shard
+	 * boundary are queued and moved at sync() points, where all of an entity's components leave the
+	 * source collections in one compacting pass and are appended to the target collections in bulk.
+	 * @code
+	 * ShardedWorld<Position, Velocity> world( 16U );
+	 * world.addSystem<MovementSystem>( deltaTime );
+	 * world.update();
+	 * world.partition<Position>( []( const Position& position ) { return cellOf(position); } );
+	 * world.sync();
+	 * @endcode
+	 * @warning A migrated entity is given a new EntityId in the target shard, @see sync(OnMigrated)
+	 *
+	 * @tparam Components  All component types that entities of the shards may have
+	 */
+	template< typename... Components >
+	class ShardedWorld : private WorldGroup<Components...>
+	{
+		using Base = WorldGroup<Components...>;
+
+	public:
+		using typename Base::WorldType;
+		using Base::addSystem;
+		using Base::update;
+		using Base::forEachWorld;
+		using Base::threadCount;
+
+		/** @param threadCount  Threads stepping the shards including the caller, 0 selects the hardware concurrency */
+		explicit ShardedWorld( std::size_t shardCount, std::size_t threadCount = 0U )
+		: Base(threadCount)
+		, queued_(shardCount)
+		, outgoing_(shardCount, std::vector<Batch>(shardCount))
+		{
+			for ( std::size_t shard = 0U; shard < shardCount; ++shard )
+			{
+				(void)Base::createWorld();
+			}
+		}
+
+		/// World of a shard
+		WorldType& shard( std::size_t index ) noexcept
+		{ return Base::world(index); }
+
+		/// Number of shards
+		std::size_t shardCount() const noexcept
+		{ return Base::size(); }
+
+		/** Queue an entity to move to another shard at the next sync()
+		 * @remark May be called concurrently for different source shards e.g. from forEachWorld()
+		 * @remark If an entity is queued more than once before sync() the last target requested wins
+		 */
+		void migrate( std::size_t sourceShard, EntityId entityId, std::size_t targetShard )
+		{
+			assert( targetShard < shardCount() );
+			if ( targetShard != sourceShard )
+			{
+				queued_[sourceShard].push_back( Migration{ entityId, targetShard } );
+			}
+		}
+
+		/** Queue every entity whose KeyComponent maps to another shard, scanning the shards in parallel
+		 * @param shardOf  Callable returning the shard index of a const KeyComponent&
+		 */
+		template< typename KeyComponent, typename ShardOf >
+		void partition( ShardOf&& shardOf )
+		{
+			Base::forEachWorld( [this, &shardOf]( WorldType& world, std::size_t sourceShard )
+			{
+				Collection<KeyComponent>& keys = world.template get<KeyComponent>();
+				const auto& ids = keys.ids();
+				auto& components = keys.components();
+				for ( std::size_t i = 0U; i < ids.size(); ++i )
+				{
+					migrate( sourceShard, ids[i], static_cast<std::size_t>( shardOf( std::as_const(components[i]) ) ) );
+				}
+			});
+		}
+
+		/// Number of entities queued for the next sync()
+		std::size_t queuedCount() const noexcept
+		{
+			std::size_t count = 0U;
+			for ( const std::vector<Migration>& queue : queued_ )
+			{
+				count += queue.size();
+			}
+			return count;
+		}
+
+		/** Move all queued entities to their target shards
+		 * @return Number of entities moved
+		 */
+		std::size_t sync()
+		{ return sync( []( std::size_t, EntityId, std::size_t, EntityId ) {} ); }
+
+		/** Move all queued entities to their target shards in two parallel passes
+		 * Each source shard first moves the components of its leaving entities out with Collection::findMany()
+		 * into a column per component and target, then drops them with Collection::removeMany(). Each target
+		 * shard then allocates ids for all arriving entities with one createRange(), which are above every
+		 * existing id, so each column is appended to the target collection with one Collection::createMany().
+		 * @param onMigrated  Called as onMigrated(sourceShard, oldId, targetShard, newId) by the thread of the
+		 *                    target shard, e.g. to remap stored entity references
+		 * @return Number of entities moved
+		 */
+		template< typename OnMigrated >
+		std::size_t sync( OnMigrated&& onMigrated )
+		{
+			if ( queuedCount() == 0U )
+			{
+				return 0U;
+			}
+
+			Base::forEachWorld( [this]( WorldType& world, std::size_t sourceShard )
+			{
+				extract( world, sourceShard );
+			});
+
+			// Duplicate and stale migrations were dropped by extract()
+			std::size_t count = 0U;
+			for ( const std::vector<Batch>& outgoing : outgoing_ )
+			{
+				for ( const Batch& batch : outgoing )
+				{
+					count += batch.entityIds.size();
+				}
+			}
+
+			Base::forEachWorld( [this, &onMigrated]( WorldType& world, std::size_t targetShard )
+			{
+				std::size_t arriving = 0U;
+				for ( std::size_t sourceShard = 0U; sourceShard < shardCount(); ++sourceShard )
+				{
+					arriving += outgoing_[sourceShard][targetShard].entityIds.size();
+				}
+				if ( arriving == 0U )
+				{
+					return;
+				}
+
+				// Arrivals take consecutive ids in source shard order
+				const EntityRange entities{ world.createRange( arriving ), arriving };
+				(insertComponents<Components>( world.template get<Components>(), entities, targetShard ), ...);
+
+				std::size_t offset = 0U;
+				for ( std::size_t sourceShard = 0U; sourceShard < shardCount(); ++sourceShard )
+				{
+					Batch& batch = outgoing_[sourceShard][targetShard];
+					for ( std::size_t i = 0U; i < batch.entityIds.size(); ++i )
+					{
+						onMigrated( sourceShard, batch.entityIds[i], targetShard, entities[offset + i] );
+					}
+					offset += batch.entityIds.size();
+					batch.entityIds.clear();
+				}
+			});
+
+			return count;
+		}
+
+	private:
+		/** Entity queued to leave a shard */
+		struct Migration
+		{
+			EntityId entityId; ///< Id in the source shard
+			std::size_t targetShard; ///< Shard to move to
+
+			friend bool operator<( const Migration& lhs, const Migration& rhs ) noexcept
+			{ return lhs.entityId < rhs.entityId; }
+		};
+
+		/** Components of one type leaving a shard for the same target */
+		template< typename Component >
+		struct Column
+		{
+			std::vector<std::uint32_t> indices; ///< Ascending index of the entity within the Batch
+			std::vector<Component> components; ///< components[i] belongs to entity indices[i]
+		};
+
+		/** Entities in transit from one shard to another */
+		struct Batch
+		{
+			std::vector<EntityId> entityIds; ///< Ids in the source shard, ascending
+			std::tuple< Column<Components>... > columns; ///< Components the entities had
+		};
+
+		/** Move the components of the queued entities of a shard into the outgoing batches */
+		void extract( WorldType& world, std::size_t sourceShard )
+		{
+			std::vector<Migration>& queue = queued_[sourceShard];
+			if ( queue.empty() )
+			{
+				return;
+			}
+
+			// Keep the last request of each entity, the stable sort leaves them in queued order
+			std::stable_sort( queue.begin(), queue.end() );
+			queue.erase( queue.begin(), std::unique( queue.rbegin(), queue.rend()
+				, []( const Migration& lhs, const Migration& rhs ) { return lhs.entityId == rhs.entityId; } ).base() );
+
+			std::vector<EntityId> entityIds( queue.size() );
+			for ( std::size_t i = 0U; i < queue.size(); ++i )
+			{
+				entityIds[i] = queue[i].entityId;
+			}
+
+			// Find every component first, stale ids of entities without any component in the shard are dropped
+			std::tuple< std::vector<Components*>... > found( std::vector<Components*>( queue.size() )... );
+			(world.template get<Components>().findMany( entityIds, std::get< std::vector<Components*> >(found) ), ...);
+
+			std::vector< Batch >& outgoing = outgoing_[sourceShard];
+			std::vector<std::uint32_t> batchIndices( queue.size() );
+			for ( std::size_t i = 0U; i < queue.size(); ++i )
+			{
+				if ( ((std::get< std::vector<Components*> >(found)[i] != nullptr) || ...) )
+				{
+					std::vector<EntityId>& batchIds = outgoing[queue[i].targetShard].entityIds;
+					batchIndices[i] = static_cast<std::uint32_t>( batchIds.size() );
+					batchIds.push_back( entityIds[i] );
+				}
+			}
+
+			(extractComponent<Components>( world.template get<Components>(), queue, entityIds
+				, std::get< std::vector<Components*> >(found), batchIndices, outgoing ), ...);
+			queue.clear();
+		}
+
+		template< typename Component >
+		static void extractComponent( Collection<Component>& collection, std::span<const Migration> queue, std::span<const EntityId> entityIds
+			, std::span<Component*> components, std::span<const std::uint32_t> batchIndices, std::vector<Batch>& outgoing )
+		{
+			for ( std::size_t i = 0U; i < entityIds.size(); ++i )
+			{
+				if ( components[i] != nullptr )
+				{
+					Column<Component>& column = std::get< Column<Component> >( outgoing[queue[i].targetShard].columns );
+					column.indices.push_back( batchIndices[i] );
+					column.components.push_back( std::move(*components[i]) );
+				}
+			}
+			collection.removeMany( entityIds );
+		}
+
+		/** Append the arriving components of one type from every source shard with a single createMany() */
+		template< typename Component >
+		void insertComponents( Collection<Component>& collection, EntityRange entities, std::size_t targetShard )
+		{
+			std::vector<EntityId> entityIds;
+			std::vector<Component> components;
+			std::size_t offset = 0U;
+			for ( std::size_t sourceShard = 0U; sourceShard < shardCount(); ++sourceShard )
+			{
+				Batch& batch = outgoing_[sourceShard][targetShard];
+				Column<Component>& column = std::get< Column<Component> >( batch.columns );
+				for ( std::size_t i = 0U; i < column.indices.size(); ++i )
+				{
+					entityIds.push_back( entities[offset + column.indices[i]] );
+					components.push_back( std::move(column.components[i]) );
+				}
+				offset += batch.entityIds.size();
+				column.indices.clear();
+				column.components.clear();
+			}
+			collection.createMany( entityIds, components );
+		}
+
+	private:
+		std::vector< std::vector<Migration> > queued_; //< Entities to move per source shard
+		std::vector< std::vector<Batch> > outgoing_; //< Entities in transit per [source][target] shard
+	};
+
+} //END: SubzeroECS
@@ -0,0 +1,380 @@
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new> //< placement new
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility> //< std::move
+#include <vector>
+
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Collection.hpp"
+#include "EntityId.hpp"
+#include "StaticWorld.hpp"
+
+namespace SubzeroECS
+{
+	/** Placement of one component column within a shared memory mirror */
+	struct SharedColumnHeader
+	{
+		std::uint64_t elementSize; ///< sizeof(Component)
+		std::uint64_t capacity; ///< Maximum number of entities in the column
+		std::uint64_t count; ///< Number of entities in the published frame
+		std::uint64_t idsOffset; ///< Byte offset of the EntityId array from the region start
+		std::uint64_t dataOffset; ///< Byte offset of the component array from the region start
+	};
+
+	/** Header at the start of a shared memory mirror, followed by the column headers
+	 * The sequence is a seqlock: odd while the writer is updating the columns and incremented to the next even
+	 * value once the frame is complete, so a reader that sees the same even value before and after copying
+	 * the columns has copied a consistent frame.
+	 */
+	struct SharedFrameHeader
+	{
+		static constexpr std::uint32_t Magic = 0x5A45'4353U; ///< "ZECS" tag of a SubzeroECS mirror
+
+		std::uint32_t magic; ///< Magic once the writer has initialised the region
+		std::uint32_t columnCount; ///< Number of SharedColumnHeader following the header
+		std::atomic<std::uint64_t> sequence; ///< Seqlock version, odd while a frame is being written
+		std::uint64_t frame; ///< Frame number of the published frame
+
+		static_assert( std::atomic<std::uint64_t>::is_always_lock_free, "Seqlock must be lock-free to be shared between processes" );
+	};
+
+	namespace Detail
+	{
+		/// Column arrays are cache line aligned
+		constexpr std::size_t SharedAlignment = 64U;
+
+		constexpr std::size_t sharedAlign( std::size_t offset ) noexcept
+		{ return (offset + SharedAlignment - 1U) & ~(SharedAlignment - 1U); }
+
+		/** Compute the column layout and total region size for Components with @p capacity entities each */
+		template< typename... Components >
+		std::size_t sharedLayout( std::size_t capacity, SharedColumnHeader* columns )
+		{
+			std::size_t offset = sharedAlign( sizeof(SharedFrameHeader) + sizeof...(Components) * sizeof(SharedColumnHeader) );
+			const std::size_t elementSizes[] = { sizeof(Components)... };
+			for ( std::size_t i = 0U; i < sizeof...(Components); ++i )
+			{
+				columns[i].elementSize = elementSizes[i];
+				columns[i].capacity = capacity;
+				columns[i].count = 0U;
+				columns[i].idsOffset = offset;
+				offset = sharedAlign( offset + capacity * sizeof(EntityId) );
+				columns[i].dataOffset = offset;
+				offset = sharedAlign( offset + capacity * elementSizes[i] );
+			}
+			return offset;
+		}
+
+		[[noreturn]] inline void throwSystemError( const char* operation )
+		{ throw std::system_error( errno, std::generic_category(), operation ); }
+
+		/** Map a POSIX shared memory object, closing the descriptor once mapped */
+		inline std::byte* mapShared( int fd, std::size_t size, bool writable )
+		{
+			void* region = ::mmap( nullptr, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0 );
+			::close( fd );
+			if ( region == MAP_FAILED )
+				throwSystemError( "mmap" );
+			return static_cast<std::byte*>( region );
+		}
+
+		/** Wait between attempts to read a frame the writer is publishing
+		 * Spins with a growing number of CPU pauses for short publishes, then yields the thread as copying
+		 * large columns takes the writer far longer than a read attempt
+		 */
+		inline void readBackoff( std::size_t attempt ) noexcept
+		{
+			constexpr std::size_t SpinAttempts = 8U;
+			if ( attempt >= SpinAttempts )
+			{
+				(void)::sched_yield();
+				return;
+			}
+			for ( std::size_t i = 0U; i < (std::size_t{1U} << attempt); ++i )
+			{
+#if defined(__x86_64__) || defined(__i386__)
+				__builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+				__asm__ __volatile__( "yield" );
+#endif
+			}
+		}
+	} //END: Detail
+
+	/** Publishes frames of selected component columns to a POSIX shared memory object
+	 *
+	 * External processes, e.g. a renderer or debug tools, map the object read-only with SharedMemoryReader
+	 * and copy consistent frames with no serialisation. Each publish() copies the ids and components of the
+	 * collections into the region under a seqlock, so the writer never waits on readers.
+	 * @code
+	 * SharedMemoryWriter<Position, Colour> mirror( "/balls", 100000U );
+	 * mirror.publish( frame, world.get<Position>(), world.get<Colour>() );
+	 * @endcode
+	 * @tparam Components  Trivially copyable component types of the mirrored columns, in column order
+	 */
+	template< typename... Components >
+	class SharedMemoryWriter
+	{
+		static_assert( sizeof...(Components) > 0U, "SharedMemoryWriter requires at least one component column" );
+		static_assert( (std::is_trivially_copyable_v<Components> && ...), "Shared memory columns must be trivially copyable" );
+
+	public:
+		/** Create a new shared memory object, replacing any object left under the name e.g. by a crashed writer
+		 * The old object is only unlinked, so readers still mapping it keep reading its last frame rather than
+		 * seeing it reset or truncated.
+		 * @param name      POSIX shared memory name e.g. "/subzero-world"
+		 * @param capacity  Maximum number of entities mirrored per column
+		 * @throw std::system_error if the object cannot be created, e.g. another writer created it concurrently
+		 */
+		SharedMemoryWriter( std::string name, std::size_t capacity )
+			: name_(std::move(name))
+		{
+			SharedColumnHeader columns[sizeof...(Components)];
+			size_ = Detail::sharedLayout<Components...>( capacity, columns );
+
+			if ( ::shm_unlink( name_.c_str() ) != 0 && errno != ENOENT )
+				Detail::throwSystemError( "shm_unlink" );
+			const int fd = ::shm_open( name_.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+			if ( fd < 0 )
+				Detail::throwSystemError( "shm_open" );
+			if ( ::ftruncate( fd, static_cast<off_t>(size_) ) != 0 )
+			{
+				const int error = errno;
+				::close( fd );
+				::shm_unlink( name_.c_str() );
+				throw std::system_error( error, std::generic_category(), "ftruncate" );
+			}
+			region_ = Detail::mapShared( fd, size_, true );
+
+			SharedFrameHeader* header = new (region_) SharedFrameHeader{ 0U, sizeof...(Components), {0U}, 0U };
+			std::memcpy( region_ + sizeof(SharedFrameHeader), columns, sizeof(columns) );
+			std::atomic_thread_fence( std::memory_order_release );
+			header->magic = SharedFrameHeader::Magic;
+		}
+
+		SharedMemoryWriter( const SharedMemoryWriter& ) = delete;
+		SharedMemoryWriter& operator=( const SharedMemoryWriter& ) = delete;
+
+		/** Unmap and unlink the shared memory object, readers keep their existing mappings */
+		~SharedMemoryWriter()
+		{
+			::munmap( region_, size_ );
+			::shm_unlink( name_.c_str() );
+		}
+
+		/** Copy the collections into the region as frame number @p frame
+		 * @throw std::length_error if a collection exceeds the capacity, the previous frame remains published
+		 */
+		void publish( std::uint64_t frame, Collection<Components>&... collections )
+		{
+			const std::size_t sizes[] = { collections.size()... };
+			if ( std::any_of( std::begin(sizes), std::end(sizes), [this]( std::size_t size ) { return size > columns()[0].capacity; } ) )
+				throw std::length_error( "Collection exceeds SharedMemoryWriter capacity" );
+
+			SharedFrameHeader& header = this->header();
+			const std::uint64_t sequence = header.sequence.load( std::memory_order_relaxed );
+			header.sequence.store( sequence + 1U, std::memory_order_relaxed );
+			std::atomic_thread_fence( std::memory_order_release );
+
+			std::size_t column = 0U;
+			(writeColumn( columns()[column++], collections ), ...);
+			header.frame = frame;
+
+			header.sequence.store( sequence + 2U, std::memory_order_release );
+		}
+
+		/** Copy the collections of a StaticWorld, @see publish() */
+		template< typename... WorldComponents >
+		void publish( std::uint64_t frame, StaticWorld<WorldComponents...>& world )
+		{ publish( frame, world.template get<Components>()... ); }
+
+		const std::string& name() const noexcept
+		{ return name_; }
+
+		/// Size of the mapped region in bytes
+		std::size_t size() const noexcept
+		{ return size_; }
+
+	private:
+		SharedFrameHeader& header() noexcept
+		{ return *reinterpret_cast<SharedFrameHeader*>( region_ ); }
+
+		SharedColumnHeader* columns() noexcept
+		{ return reinterpret_cast<SharedColumnHeader*>( region_ + sizeof(SharedFrameHeader) ); }
+
+		template< typename Component >
+		void writeColumn( SharedColumnHeader& column, Collection<Component>& collection )
+		{
+			const std::size_t count = collection.size();
+			std::memcpy( region_ + column.idsOffset, collection.ids().data(), count * sizeof(EntityId) );
+
+			auto& components = collection.components();
+			if constexpr ( std::is_same_v< std::remove_cvref_t<decltype(components)>, std::vector<Component> > )
+				std::memcpy( region_ + column.dataOffset, components.data(), count * sizeof(Component) );
+			else
+				std::copy( components.begin(), components.end(), reinterpret_cast<Component*>( region_ + column.dataOffset ) );
+			column.count = count;
+		}
+
+	private:
+		std::string name_; //< Shared memory object name
+		std::byte* region_ = nullptr; //< Mapped region
+		std::size_t size_ = 0U; //< Mapped size in bytes
+	};
+
+	/** Consistent copy of a frame read from a SharedMemoryReader */
+	template< typename... Components >
+	struct SharedFrame
+	{
+		/** Column of entity ids and their components where components[i] belongs to ids[i] */
+		template< typename Component >
+		struct Column
+		{
+			std::vector<EntityId> ids; ///< Sorted ids of the entities in the column
+			std::vector<Component> components; ///< Components of the entities
+		};
+
+		std::uint64_t frame = 0U; ///< Frame number passed to SharedMemoryWriter::publish()
+		std::tuple< Column<Components>... > columns; ///< Copied columns
+
+		template< typename Component >
+		Column<Component>& get() noexcept
+		{ return std::get< Column<Component> >(columns); }
+	};
+
+	/** Maps a SharedMemoryWriter region read-only and copies consistent frames from it
+	 * @tparam Components  Component types matching the writer, in column order
+	 */
+	template< typename... Components >
+	class SharedMemoryReader
+	{
+	public:
+		using Frame = SharedFrame<Components...>;
+
+		/** Open an existing shared memory object
+		 * @throw std::system_error if the object does not exist, std::invalid_argument if its layout does not match
+		 */
+		explicit SharedMemoryReader( const std::string& name )
+		{
+			const int fd = ::shm_open( name.c_str(), O_RDONLY, 0 );
+			if ( fd < 0 )
+				Detail::throwSystemError( "shm_open" );
+			struct stat status {};
+			if ( ::fstat( fd, &status ) != 0 )
+			{
+				const int error = errno;
+				::close( fd );
+				throw std::system_error( error, std::generic_category(), "fstat" );
+			}
+			size_ = static_cast<std::size_t>( status.st_size );
+			if ( size_ < sizeof(SharedFrameHeader) + sizeof...(Components) * sizeof(SharedColumnHeader) )
+			{
+				::close( fd );
+				throw std::invalid_argument( "Shared memory object is not a SharedMemoryWriter region" );
+			}
+			region_ = Detail::mapShared( fd, size_, false );
+
+			const SharedFrameHeader& header = this->header();
+			const std::size_t elementSizes[] = { sizeof(Components)... };
+			bool valid = header.magic == SharedFrameHeader::Magic && header.columnCount == sizeof...(Components);
+			std::atomic_thread_fence( std::memory_order_acquire );
+			for ( std::size_t i = 0U; valid && i < sizeof...(Components); ++i )
+			{
+				const SharedColumnHeader& column = columns()[i];
+				valid = column.elementSize == elementSizes[i]
+					&& column.dataOffset + column.capacity * column.elementSize <= size_;
+			}
+			if ( !valid )
+			{
+				::munmap( const_cast<std::byte*>(region_), size_ );
+				throw std::invalid_argument( "Shared memory layout does not match the SharedMemoryReader components" );
+			}
+		}
+
+		SharedMemoryReader( const SharedMemoryReader& ) = delete;
+		SharedMemoryReader& operator=( const SharedMemoryReader& ) = delete;
+
+		~SharedMemoryReader()
+		{ ::munmap( const_cast<std::byte*>(region_), size_ ); }
+
+		/** Copy the latest complete frame into @p frame, backing off and retrying while the writer is mid-frame
+		 * @param timeout  Time to keep retrying, microseconds::max() waits without limit
+		 * @return false if no consistent frame was copied before the timeout, or no frame has been published
+		 */
+		bool read( Frame& frame, std::chrono::microseconds timeout = std::chrono::milliseconds(100) )
+		{
+			using Clock = std::chrono::steady_clock;
+			const SharedFrameHeader& header = this->header();
+			const Clock::time_point start = Clock::now();
+			for ( std::size_t attempt = 0U; ; ++attempt )
+			{
+				const std::uint64_t sequence = header.sequence.load( std::memory_order_acquire );
+				if ( sequence == 0U )
+					return false;
+				if ( (sequence & 1U) == 0U )
+				{
+					std::size_t column = 0U;
+					(readColumn( columns()[column++], frame.template get<Components>() ), ...);
+					frame.frame = header.frame;
+
+					std::atomic_thread_fence( std::memory_order_acquire );
+					if ( header.sequence.load( std::memory_order_relaxed ) == sequence )
+						return true;
+				}
+
+				if ( timeout != std::chrono::microseconds::max() && Clock::now() - start >= timeout )
+					return false;
+				Detail::readBackoff( attempt );
+			}
+		}
+
+		/// Sequence of the last completed frame, changes whenever a new frame is published
+		std::uint64_t sequence() const noexcept
+		{ return header().sequence.load( std::memory_order_acquire ) & ~std::uint64_t{1U}; }
+
+	private:
+		const SharedFrameHeader& header() const noexcept
+		{ return *reinterpret_cast<const SharedFrameHeader*>( region_ ); }
+
+		const SharedColumnHeader* columns() const noexcept
+		{ return reinterpret_cast<const SharedColumnHeader*>( region_ + sizeof(SharedFrameHeader) ); }
+
+		/** Copy a column, the count is clamped as a torn read may observe any value */
+		template< typename Component >
+		void readColumn( const SharedColumnHeader& header, typename Frame::template Column<Component>& column )
+		{
+			const std::size_t count = std::min<std::size_t>( header.count, header.capacity );
+			column.ids.resize( count );
+			column.components.resize( count );
+			std::memcpy( column.ids.data(), region_ + header.idsOffset, count * sizeof(EntityId) );
+			std::memcpy( static_cast<void*>(column.components.data()), region_ + header.dataOffset, count * sizeof(Component) );
+		}
+
+	private:
+		const std::byte* region_ = nullptr; //< Read-only mapped region
+		std::size_t size_ = 0U; //< Mapped size in bytes
+	};
+
+} //END: SubzeroECS
+
+#endif // defined(__unix__) || defined(__APPLE__)
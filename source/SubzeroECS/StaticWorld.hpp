@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility> //< std::forward
+
+#include "Collection.hpp"
+#include "EntityId.hpp"
+#include "Prefab.hpp"
+
+namespace SubzeroECS
+{
+	/** World with a component list fixed at compile-time
+	 *
+	 * Owns a Collection for each component directly, so every collection lookup resolves at compile-time
+	 * with no CollectionRegistry tables, UniqueIndex32 allocation or registration checks.
+	 * View and System accept a StaticWorld in place of a World.
+	 *
+	 * @tparam Components  All component types that entities of this world may have
+	 */
+	template< typename... Components >
+	class StaticWorld
+	{
+	public:
+		using Collections = std::tuple< Collection<Components>... >; ///< All component collections
+
+		StaticWorld()
+		: lastEntityId_(EntityId::Invalid)
+		{}
+
+		StaticWorld( const StaticWorld& ) = delete;
+		StaticWorld& operator=( const StaticWorld& ) = delete;
+
+		EntityId create()
+		{
+			return newEntityId();
+		}
+
+		/** Reserve ids for count new entities without adding any components
+		 * The ids are consecutive and above every existing id, so bulk-added components are appended to the
+		 * collections, @see Collection::createMany()
+		 * @return First id of the range, the remaining ids follow in order
+		 * @throw std::overflow_error if the ids would exceed the EntityId range
+		 */
+		EntityId createRange( std::size_t count )
+		{
+			const EntityId first = lastEntityId_.next();
+			if ( count == 0U )
+				return first;
+			if ( count - 1U >= static_cast<std::size_t>( EntityId::Invalid.value - first.value ) )
+				throw std::overflow_error( "EntityId range overflow for call to createRange()" );
+			lastEntityId_ = EntityId{ static_cast<std::uint32_t>( first.value + (count - 1U) ) };
+			return first;
+		}
+
+		template<typename... EntityComponents>
+		EntityId create(EntityComponents&&... items)
+		{
+			EntityId entityId = newEntityId();
+			(get<std::remove_cvref_t<EntityComponents>>().create(entityId, std::forward<EntityComponents>(items)), ...);
+			return entityId;
+		}
+
+		/** Spawn count copies of a prefab with a single reserve and fill of each component column
+		 * @return Ids of the instances, consecutive and above every existing id
+		 */
+		template<typename... PrefabComponents>
+		EntityRange instantiate( const Prefab<PrefabComponents...>& prefab, std::size_t count )
+		{ return instantiate( prefab, count, []( EntityId, PrefabComponents&... ) {} ); }
+
+		/** Spawn count copies of a prefab, calling init(EntityId, PrefabComponents&...) to customise each instance */
+		template<typename... PrefabComponents, typename InitFn>
+		EntityRange instantiate( const Prefab<PrefabComponents...>& prefab, std::size_t count, InitFn&& init )
+		{
+			const EntityRange entities{ createRange( count ), count };
+			Detail::instantiatePrefab( prefab, entities, init, get<PrefabComponents>()... );
+			return entities;
+		}
+
+		template<typename Component>
+		void add( EntityId entityId, const Component& item )
+		{
+			get<Component>().create(entityId, Component(item) );
+		}
+
+		template<typename Component>
+		void add( EntityId entityId, Component&& item )
+		{
+			get<std::remove_cvref_t<Component>>().create(entityId, std::forward<Component>(item));
+		}
+
+		template<typename Component>
+		bool remove( EntityId entityId )
+		{ return get<Component>().remove(entityId); }
+
+		template<typename Component>
+		bool has( EntityId entityId )
+		{ return get<Component>().has(entityId); }
+
+		template<typename Component>
+		Component* find( EntityId entityId )
+		{ return get<Component>().find(entityId); }
+
+		/** Get reference to a component of the specified entityId
+		@warning Will throw exception if the entityId was not found, use find() if component existance is unknown
+		*/
+		template<typename Component>
+		Component& get( EntityId entityId )
+		{ return get<Component>().get(entityId); }
+
+		/** Get pointers to the components of many entities at once, @see Collection::findMany() */
+		template<typename Component>
+		void getMany( std::span<const EntityId> entityIds, std::span<Component*> components )
+		{ get<Component>().findMany(entityIds, components); }
+
+		/** Remove every entity and restart EntityIds from the first id, keeping the collection allocations
+		 * @warning EntityIds from before the clear refer to the new entities reusing their ids
+		 */
+		void clear() noexcept
+		{
+			std::apply( []( Collection<Components>&... collections ) { (collections.clear(), ...); }, collections_ );
+			lastEntityId_ = EntityId::Invalid;
+		}
+
+		/** Empty the collections of every transient component e.g. at the end of a frame, @see ComponentTransient */
+		void clearTransients() noexcept
+		{
+			([this]()
+			{
+				if constexpr ( Collection<Components>::IsTransient )
+					get<Components>().clear();
+			}(), ...);
+		}
+
+		/** Get the collection for a component type resolved at compile-time */
+		template<typename Component>
+		Collection<Component>& get() noexcept
+		{ return std::get<Collection<Component>>(collections_); }
+
+		template<typename Component>
+		const Collection<Component>& get() const noexcept
+		{ return std::get<Collection<Component>>(collections_); }
+
+	private:
+
+		EntityId newEntityId()
+		{ return lastEntityId_ = lastEntityId_.next(); }
+
+	private:
+		Collections collections_; //< Component collections
+		EntityId lastEntityId_; //< Id of the last created entity where (0 is invalid/null)
+	};
+
+} //END: SubzeroECS
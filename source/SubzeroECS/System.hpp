@@ -1,6 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
 #include <tuple>
+#include <type_traits>
 #include "Collection.hpp"
 #include "View.hpp"
 
@@ -14,6 +19,22 @@ namespace SubzeroECS
 		virtual void update() = 0;
 	};
 
+	/** Limits of a single time-sliced System::updateSlice() */
+	struct SliceBudget
+	{
+		std::size_t maxEntities = std::numeric_limits<std::size_t>::max(); ///< Entities processed per slice
+		std::chrono::microseconds maxDuration = std::chrono::microseconds::max(); ///< Time per slice, @see System::ClockCheckInterval
+
+		/** Whether maxDuration has elapsed since @p start, never when the duration is unlimited
+		 * @note Compared in microseconds as converting maxDuration to clock ticks would overflow
+		 */
+		bool expired( std::chrono::steady_clock::time_point start ) const
+		{
+			return maxDuration != std::chrono::microseconds::max()
+				&& std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ) >= maxDuration;
+		}
+	};
+
 	// CRTP-based System class for zero-overhead virtual calls
 	template<typename Derived, typename... Components>
 	class System : public ISystem, protected View<Components...>
@@ -24,30 +45,137 @@ namespace SubzeroECS
 
 		System(CollectionRegistry& registry)
 			: View<Components...>(registry)
-			, registry_(registry)
+			, registry_(&registry)
+		{
+		}
+
+		template< typename... WorldComponents >
+		System(StaticWorld<WorldComponents...>& world)
+			: View<Components...>(world)
+			, registry_(nullptr)
 		{
 		}
 
 		// Non-virtual update that calls derived class's processEntity
+		// @note processEntity may take the Iterator or the components (and EntityId) it accesses,
+		//       the latter are deduced from its signature and iterated internally with View::each()
 		void update() override
 		{
+			Derived* derived = static_cast<Derived*>(this);
+			if constexpr ( requires( Derived& system, Iterator iEntity ) { system.processEntity(iEntity); } )
+			{
+				const auto iEnd = this->ViewType::end();
+				for (auto iEntity = this->ViewType::begin(); iEntity != iEnd; ++iEntity)
+				{
+					derived->processEntity(iEntity);
+				}
+			}
+			else
+			{
+				using Arguments = typename Utility::CallableTraits<decltype(&Derived::processEntity)>::Arguments;
+				this->ViewType::template eachAs<Arguments>( [derived]( auto&&... args )
+				{
+					derived->processEntity( std::forward<decltype(args)>(args)... );
+				});
+			}
+		}
+
+		/// Entities processed between clock reads of a duration limited updateSlice()
+		static constexpr std::size_t ClockCheckInterval = 16U;
+
+		/** Process a budgeted slice of the view resuming after the last entity processed by the previous slice
+		 * Spreads systems that need not touch every entity every frame (e.g. AI re-planning, far LOD) over
+		 * several frames. The resume position is found by galloping to the cursor EntityId, so slices remain
+		 * correct when entities are added or removed between them.
+		 * @return true if the slice reached the end of the view, the next slice then restarts from the beginning
+		 */
+		bool updateSlice( const SliceBudget& budget )
+		{
+			using Clock = std::chrono::steady_clock;
+			Derived* derived = static_cast<Derived*>(this);
+			const auto start = Clock::now();
+
+			auto iEntity = isNull(cursor_) ? this->ViewType::begin() : this->ViewType::seek( cursor_.next(), cursorHints_ );
 			const auto iEnd = this->ViewType::end();
-			for (auto iEntity = this->ViewType::begin(); iEntity != iEnd; ++iEntity)
+			std::size_t processed = 0U;
+			for ( ; iEntity != iEnd; ++iEntity )
+			{
+				if ( processed == budget.maxEntities )
+					break;
+				if ( (processed != 0U) && (processed % ClockCheckInterval == 0U) && budget.expired( start ) )
+					break;
+
+				processEntityAt( derived, iEntity );
+				cursor_ = iEntity;
+				++processed;
+			}
+
+			if ( iEntity == iEnd )
 			{
-				static_cast<Derived*>(this)->processEntity(iEntity);
+				cursor_ = EntityId::Invalid;
+				return true;
 			}
+			cursorHints_ = this->ViewType::seekHints( iEntity );
+			return false;
 		}
 
+		/** Last entity processed by updateSlice(), EntityId::Invalid at the start of the view */
+		EntityId cursor() const noexcept
+		{ return cursor_; }
+
 	protected:
 		// Helper to get a component by EntityId
+		// @note Components of this system resolve via the view, others require a CollectionRegistry
 		template<typename Component>
 		Component& get(SubzeroECS::EntityId entityId)
 		{
-			return registry_.get<Component>().get(entityId);
+			if constexpr ((std::is_same_v<Component, Components> || ...))
+			{
+				return ViewType::template getCollection<Component>().get(entityId);
+			}
+			else
+			{
+				if ( registry_ == nullptr )
+					throw std::logic_error( "System::get() of component outside the system requires a CollectionRegistry" );
+				return registry_->get<Component>().get(entityId);
+			}
+		}
+
+	private:
+
+		/** Invoke processEntity for the entity at an iterator matching its signature */
+		static void processEntityAt( Derived* derived, const Iterator& iEntity )
+		{
+			if constexpr ( requires( Derived& system, Iterator it ) { system.processEntity(it); } )
+			{
+				derived->processEntity( iEntity );
+			}
+			else
+			{
+				using Arguments = typename Utility::CallableTraits<decltype(&Derived::processEntity)>::Arguments;
+				processArguments( derived, iEntity, static_cast<Arguments*>(nullptr) );
+			}
+		}
+
+		template< typename... Args >
+		static void processArguments( Derived* derived, const Iterator& iEntity, std::tuple<Args...>* )
+		{
+			derived->processEntity( argument<Args>( iEntity )... );
+		}
+
+		template< typename Arg >
+		static decltype(auto) argument( const Iterator& iEntity )
+		{
+			if constexpr ( std::is_same_v<Bare<Arg>, EntityId> )
+				return static_cast<EntityId>( iEntity );
+			else
+				return (iEntity.template get<Bare<Arg>>());
 		}
 
 	private:
-		CollectionRegistry& registry_;
+		CollectionRegistry* registry_; ///< Registry for components outside the view, nullptr for StaticWorld
+		EntityId cursor_ = EntityId::Invalid; ///< Last entity processed by updateSlice()
+		typename ViewType::SeekHints cursorHints_ {}; ///< Column positions after the cursor to gallop from
 	};
 
 } //END: SubzeroECS
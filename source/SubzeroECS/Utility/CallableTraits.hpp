@@ -0,0 +1,49 @@
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+
+namespace SubzeroECS {
+namespace Utility
+{
+	/** Deduces the parameter list of a callable with a single non-template call signature
+	 * Supports function pointers, member function pointers and lambdas/functors with a non-generic operator()
+	 * @remark `Arguments` is `void` when the signature cannot be deduced (e.g. generic lambdas)
+	 */
+	template< typename Callable, typename = void >
+	struct CallableTraits
+	{
+		using Arguments = void;
+	};
+
+	template< typename Callable >
+	struct CallableTraits< Callable, std::void_t<decltype(&Callable::operator())> >
+		: CallableTraits< decltype(&Callable::operator()) >
+	{};
+
+	template< typename Result, typename... Args >
+	struct CallableTraits< Result(*)(Args...) >
+	{
+		using Arguments = std::tuple<Args...>;
+	};
+
+	template< typename Result, typename... Args >
+	struct CallableTraits< Result(*)(Args...) noexcept > : CallableTraits< Result(*)(Args...) > {};
+
+	template< typename Class, typename Result, typename... Args >
+	struct CallableTraits< Result(Class::*)(Args...) >
+	{
+		using Arguments = std::tuple<Args...>;
+	};
+
+	template< typename Class, typename Result, typename... Args >
+	struct CallableTraits< Result(Class::*)(Args...) const > : CallableTraits< Result(Class::*)(Args...) > {};
+
+	template< typename Class, typename Result, typename... Args >
+	struct CallableTraits< Result(Class::*)(Args...) noexcept > : CallableTraits< Result(Class::*)(Args...) > {};
+
+	template< typename Class, typename Result, typename... Args >
+	struct CallableTraits< Result(Class::*)(Args...) const noexcept > : CallableTraits< Result(Class::*)(Args...) > {};
+
+} //END: Utility
+} //END: SubzeroECS
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm> //< std::fill
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SubzeroECS {
+namespace Utility
+{
+	/** Growable bitset stored as whole 256-bit blocks of 64-bit words
+	 *
+	 * Bits beyond the stored words read as zero and setting a bit grows the storage to the enclosing block,
+	 * so bitsets can be combined block-by-block without tail handling, @see words() and forEachSetBit()
+	 */
+	class DynamicBitset
+	{
+	public:
+		using Word = std::uint64_t;
+		static constexpr std::size_t WordBits = 64U; //< Bits per word
+		static constexpr std::size_t BlockWords = 4U; //< Words per block (256 bits)
+
+		bool test( std::size_t index ) const noexcept
+		{
+			const std::size_t word = index / WordBits;
+			return (word < words_.size()) && ((words_[word] >> (index % WordBits)) & 1U) != 0U;
+		}
+
+		void set( std::size_t index )
+		{
+			const std::size_t word = index / WordBits;
+			if ( word >= words_.size() )
+				words_.resize( (word / BlockWords + 1U) * BlockWords, Word{0U} );
+			words_[word] |= Word{1U} << (index % WordBits);
+		}
+
+		void reset( std::size_t index ) noexcept
+		{
+			const std::size_t word = index / WordBits;
+			if ( word < words_.size() )
+				words_[word] &= ~(Word{1U} << (index % WordBits));
+		}
+
+		/** Reset all bits retaining the allocated words */
+		void clear() noexcept
+		{ std::fill( words_.begin(), words_.end(), Word{0U} ); }
+
+		/** Number of set bits */
+		std::size_t count() const noexcept
+		{
+			std::size_t result = 0U;
+			for ( Word word : words_ )
+				result += static_cast<std::size_t>( std::popcount( word ) );
+			return result;
+		}
+
+		/** Stored words, always a whole number of blocks */
+		const Word* words() const noexcept
+		{ return words_.data(); }
+
+		std::size_t wordCount() const noexcept
+		{ return words_.size(); }
+
+	private:
+		std::vector<Word> words_; //< Bit storage, size is a multiple of BlockWords
+	};
+
+	/** Invoke func(index) for each set bit of a 64-bit word offset by the first bit index */
+	template< typename Func >
+	inline void forEachSetBit( DynamicBitset::Word word, std::size_t firstIndex, Func&& func )
+	{
+		while ( word != 0U )
+		{
+			func( firstIndex + static_cast<std::size_t>( std::countr_zero( word ) ) );
+			word &= word - 1U;
+		}
+	}
+
+} //END: Utility
+} //END: SubzeroECS
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <algorithm> //< std::max
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory> //< std::allocator, std::construct_at, std::destroy_at
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SubzeroECS {
+namespace Utility
+{
+	/** Vector of 4 byte handles into a pool of elements held in fixed-size pages
+	 *
+	 * Inserting or erasing in the middle shifts the handles rather than the elements, so heavy elements
+	 * are constructed once in the pool and never moved while their position in the vector changes.
+	 * Freed pool slots are reused by later insertions and element addresses remain stable until erased.
+	 *
+	 * @remark Iteration reads the pool through the handles, which after churn is no longer in address order
+	 * @tparam T  Element type
+	 * @tparam PageBytes  Target bytes per pool page, rounded down to a power-of-two element count (minimum 1)
+	 */
+	template< typename T, std::size_t PageBytes = 16U * 1024U >
+	class IndirectVector
+	{
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using Handle = std::uint32_t; ///< Pool slot of an element
+
+		static constexpr size_type PageSize = std::bit_floor( std::max<size_type>( PageBytes / sizeof(T), 1U ) ); //< Elements per page
+		static constexpr size_type PageShift = std::countr_zero( PageSize ); //< Handle to page shift
+		static constexpr size_type PageMask = PageSize - 1U; //< Handle to page offset mask
+
+		/** Random-access iterator addressing an element by index */
+		template< bool IsConst >
+		class BasicIterator
+		{
+		public:
+			using Owner = std::conditional_t<IsConst, const IndirectVector, IndirectVector>;
+
+			using iterator_category = std::random_access_iterator_tag;
+			using iterator_concept = std::random_access_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using reference = std::conditional_t<IsConst, const T&, T&>;
+			using pointer = std::conditional_t<IsConst, const T*, T*>;
+
+			BasicIterator() = default;
+			BasicIterator( Owner* owner, size_type index ) : owner_(owner), index_(index) {}
+
+			/** Implicit conversion of iterator to const_iterator */
+			operator BasicIterator<true>() const requires (!IsConst) { return BasicIterator<true>( owner_, index_ ); }
+
+			reference operator*() const { return (*owner_)[index_]; }
+			pointer operator->() const { return &(*owner_)[index_]; }
+			reference operator[]( difference_type n ) const { return (*owner_)[index_ + n]; }
+
+			BasicIterator& operator++() { ++index_; return *this; }
+			BasicIterator operator++(int) { BasicIterator tmp = *this; ++index_; return tmp; }
+			BasicIterator& operator--() { --index_; return *this; }
+			BasicIterator operator--(int) { BasicIterator tmp = *this; --index_; return tmp; }
+			BasicIterator& operator+=( difference_type n ) { index_ += n; return *this; }
+			BasicIterator& operator-=( difference_type n ) { index_ -= n; return *this; }
+
+			friend BasicIterator operator+( BasicIterator it, difference_type n ) { return it += n; }
+			friend BasicIterator operator+( difference_type n, BasicIterator it ) { return it += n; }
+			friend BasicIterator operator-( BasicIterator it, difference_type n ) { return it -= n; }
+			friend difference_type operator-( const BasicIterator& lhs, const BasicIterator& rhs )
+			{ return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_); }
+
+			friend bool operator==( const BasicIterator& lhs, const BasicIterator& rhs ) { return lhs.index_ == rhs.index_; }
+			friend auto operator<=>( const BasicIterator& lhs, const BasicIterator& rhs ) { return lhs.index_ <=> rhs.index_; }
+
+			/** Element index within the owning container */
+			size_type index() const { return index_; }
+
+		private:
+			Owner* owner_ = nullptr;
+			size_type index_ = 0U;
+		};
+
+		using iterator = BasicIterator<false>;
+		using const_iterator = BasicIterator<true>;
+
+	public:
+		IndirectVector() = default;
+
+		IndirectVector( const IndirectVector& ) = delete;
+		IndirectVector& operator=( const IndirectVector& ) = delete;
+
+		IndirectVector( IndirectVector&& other ) noexcept
+			: pages_( std::move(other.pages_) )
+			, handles_( std::move(other.handles_) )
+			, free_( std::move(other.free_) )
+			, slotCount_( std::exchange(other.slotCount_, 0U) )
+		{}
+
+		IndirectVector& operator=( IndirectVector&& other ) noexcept
+		{
+			if ( this != &other )
+			{
+				release();
+				pages_ = std::move(other.pages_);
+				handles_ = std::move(other.handles_);
+				free_ = std::move(other.free_);
+				slotCount_ = std::exchange(other.slotCount_, 0U);
+			}
+			return *this;
+		}
+
+		~IndirectVector()
+		{ release(); }
+
+		size_type size() const noexcept { return handles_.size(); }
+		bool empty() const noexcept { return handles_.empty(); }
+
+		/** Number of elements that can be held without allocating another page */
+		size_type capacity() const noexcept { return pages_.size() * PageSize; }
+
+		/** Allocate pages and handles so that at least @p count elements can be held
+		@note Existing elements are never moved
+		*/
+		void reserve( size_type count )
+		{
+			handles_.reserve( count );
+			while ( capacity() < count )
+				allocatePage();
+		}
+
+		reference operator[]( size_type index ) noexcept { return slot( handles_[index] ); }
+		const_reference operator[]( size_type index ) const noexcept { return slot( handles_[index] ); }
+
+		reference at( size_type index )
+		{
+			if ( index >= size() )
+				throw std::out_of_range( "IndirectVector::at() index out of range" );
+			return (*this)[index];
+		}
+
+		const_reference at( size_type index ) const
+		{
+			if ( index >= size() )
+				throw std::out_of_range( "IndirectVector::at() index out of range" );
+			return (*this)[index];
+		}
+
+		reference front() { return (*this)[0U]; }
+		reference back() { return (*this)[size() - 1U]; }
+
+		iterator begin() noexcept { return iterator( this, 0U ); }
+		iterator end() noexcept { return iterator( this, size() ); }
+		const_iterator begin() const noexcept { return const_iterator( this, 0U ); }
+		const_iterator end() const noexcept { return const_iterator( this, size() ); }
+
+		/** Pool slot of each element in order */
+		std::span<const Handle> handles() const noexcept
+		{ return handles_; }
+
+		template< typename... Args >
+		reference emplace_back( Args&&... args )
+		{
+			return *construct( handles_.size(), std::forward<Args>(args)... );
+		}
+
+		void push_back( const T& value ) { emplace_back( value ); }
+		void push_back( T&& value ) { emplace_back( std::move(value) ); }
+
+		void pop_back()
+		{
+			destroy( handles_.back() );
+			handles_.pop_back();
+		}
+
+		/** Insert an element before @p pos, shifting the handles of the tail up by one */
+		iterator insert( const_iterator pos, T&& value )
+		{
+			construct( pos.index(), std::move(value) );
+			return begin() + pos.index();
+		}
+
+		iterator insert( const_iterator pos, const T& value )
+		{ return insert( pos, T(value) ); }
+
+		/** Erase the element at @p pos, shifting the handles of the tail down by one */
+		iterator erase( const_iterator pos )
+		{
+			const size_type index = pos.index();
+			destroy( handles_[index] );
+			handles_.erase( handles_.begin() + static_cast<difference_type>(index) );
+			return begin() + index;
+		}
+
+		/** Insert many elements in a single pass merging their handles with the existing ones
+		 * @param positions  Index of the existing element each value is inserted before, sorted ascending
+		 * @param values     Elements moved from, values[i] is inserted before the element at positions[i]
+		 */
+		void insertMany( std::span<const size_type> positions, std::span<T> values )
+		{
+			assert( positions.size() == values.size() );
+			std::vector<Handle> merged;
+			merged.reserve( handles_.size() + values.size() );
+			std::vector<Handle> inserted;
+			inserted.reserve( values.size() );
+			try
+			{
+				for ( T& value : values )
+				{
+					const Handle handle = acquire();
+					try
+					{
+						std::construct_at( &slot(handle), std::move(value) );
+					}
+					catch ( ... )
+					{
+						free_.push_back( handle );
+						throw;
+					}
+					inserted.push_back( handle );
+				}
+			}
+			catch ( ... )
+			{
+				for ( const Handle handle : inserted )
+					destroy( handle );
+				throw;
+			}
+
+			size_type existing = 0U;
+			for ( size_type i = 0U; i < inserted.size(); ++i )
+			{
+				for ( ; existing < positions[i]; ++existing )
+					merged.push_back( handles_[existing] );
+				merged.push_back( inserted[i] );
+			}
+			merged.insert( merged.end(), handles_.begin() + static_cast<difference_type>(existing), handles_.end() );
+			handles_ = std::move(merged);
+		}
+
+		/** Erase the elements at many indices in a single pass compacting the handles
+		 * @param indices  Element indices sorted ascending without duplicates
+		 */
+		void eraseMany( std::span<const size_type> indices )
+		{
+			if ( indices.empty() )
+				return;
+			free_.reserve( free_.size() + indices.size() );
+
+			size_type write = indices.front();
+			size_type next = 0U;
+			for ( size_type read = indices.front(); read < handles_.size(); ++read )
+			{
+				if ( next < indices.size() && indices[next] == read )
+				{
+					destroy( handles_[read] );
+					++next;
+				}
+				else
+				{
+					handles_[write++] = handles_[read];
+				}
+			}
+			handles_.resize( write );
+		}
+
+		/** Destroy all elements retaining the allocated pages */
+		void clear() noexcept
+		{
+			for ( const Handle handle : handles_ )
+				std::destroy_at( &slot(handle) );
+			handles_.clear();
+			free_.clear();
+			slotCount_ = 0U;
+		}
+
+	private:
+		T& slot( Handle handle ) noexcept { return pages_[handle >> PageShift][handle & PageMask]; }
+		const T& slot( Handle handle ) const noexcept { return pages_[handle >> PageShift][handle & PageMask]; }
+
+		/** Construct an element in a free slot and insert its handle at @p index */
+		template< typename... Args >
+		T* construct( size_type index, Args&&... args )
+		{
+			const Handle handle = acquire();
+			try
+			{
+				handles_.insert( handles_.begin() + static_cast<difference_type>(index), handle );
+			}
+			catch ( ... )
+			{
+				free_.push_back( handle );
+				throw;
+			}
+			try
+			{
+				return std::construct_at( &slot(handle), std::forward<Args>(args)... );
+			}
+			catch ( ... )
+			{
+				handles_.erase( handles_.begin() + static_cast<difference_type>(index) );
+				free_.push_back( handle );
+				throw;
+			}
+		}
+
+		/** Take a free pool slot, allocating a page when every slot is in use */
+		Handle acquire()
+		{
+			if ( !free_.empty() )
+			{
+				const Handle handle = free_.back();
+				free_.pop_back();
+				return handle;
+			}
+			if ( slotCount_ == capacity() )
+				allocatePage();
+			return slotCount_++;
+		}
+
+		void destroy( Handle handle )
+		{
+			std::destroy_at( &slot(handle) );
+			free_.push_back( handle );
+		}
+
+		void allocatePage()
+		{
+			pages_.push_back( std::allocator<T>().allocate( PageSize ) );
+		}
+
+		void release() noexcept
+		{
+			clear();
+			for ( T* page : pages_ )
+				std::allocator<T>().deallocate( page, PageSize );
+			pages_.clear();
+		}
+
+	private:
+		std::vector<T*> pages_; //< Pool page table, each page holds PageSize elements
+		std::vector<Handle> handles_; //< Pool slot of each element in order
+		std::vector<Handle> free_; //< Pool slots below slotCount_ that hold no element
+		Handle slotCount_ = 0U; //< Number of pool slots ever used
+	};
+
+} //END: Utility
+} //END: SubzeroECS
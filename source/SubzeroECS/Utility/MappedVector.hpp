@@ -0,0 +1,253 @@
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility> //< std::exchange, std::forward
+
+#include <stdlib.h> //< mkstemp
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace SubzeroECS {
+namespace Utility
+{
+	/** Directory in which MappedVector creates its backing files, defaults to $TMPDIR or /tmp
+	 * @remark Point this at a disk with room for the largest world, changes apply to vectors grown afterwards
+	 */
+	inline std::string& mappedFileDirectory()
+	{
+		static std::string directory = []()
+		{
+			const char* tmp = ::getenv( "TMPDIR" );
+			return std::string( (tmp != nullptr && *tmp != '\0') ? tmp : "/tmp" );
+		}();
+		return directory;
+	}
+
+	/** Contiguous vector of trivially copyable values held in a memory-mapped file
+	 *
+	 * The backing file is created on first growth and unlinked immediately, so the kernel pages the
+	 * contents to and from that file instead of swap and a column may exceed physical memory.
+	 * Growth extends the file with ftruncate and remaps it, doubling the capacity.
+	 * @remark Provides the subset of the std::vector interface used by Collection
+	 */
+	template< typename T >
+	class MappedVector
+	{
+		static_assert( std::is_trivially_copyable_v<T>, "MappedVector elements are relocated with memcpy" );
+
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		/// Smallest mapping in bytes
+		static constexpr size_type MinimumBytes = 64U * 1024U;
+
+		MappedVector() = default;
+
+		MappedVector( const MappedVector& ) = delete;
+		MappedVector& operator=( const MappedVector& ) = delete;
+
+		MappedVector( MappedVector&& other ) noexcept
+			: data_( std::exchange( other.data_, nullptr ) )
+			, size_( std::exchange( other.size_, 0U ) )
+			, capacity_( std::exchange( other.capacity_, 0U ) )
+			, mappedBytes_( std::exchange( other.mappedBytes_, 0U ) )
+			, fd_( std::exchange( other.fd_, -1 ) )
+		{}
+
+		MappedVector& operator=( MappedVector&& other ) noexcept
+		{
+			if ( this != &other )
+			{
+				release();
+				data_ = std::exchange( other.data_, nullptr );
+				size_ = std::exchange( other.size_, 0U );
+				capacity_ = std::exchange( other.capacity_, 0U );
+				mappedBytes_ = std::exchange( other.mappedBytes_, 0U );
+				fd_ = std::exchange( other.fd_, -1 );
+			}
+			return *this;
+		}
+
+		~MappedVector()
+		{ release(); }
+
+		iterator begin() noexcept { return data_; }
+		iterator end() noexcept { return data_ + size_; }
+		const_iterator begin() const noexcept { return data_; }
+		const_iterator end() const noexcept { return data_ + size_; }
+
+		T* data() noexcept { return data_; }
+		const T* data() const noexcept { return data_; }
+
+		size_type size() const noexcept { return size_; }
+		size_type capacity() const noexcept { return capacity_; }
+		bool empty() const noexcept { return size_ == 0U; }
+
+		reference operator[]( size_type index ) noexcept { return data_[index]; }
+		const_reference operator[]( size_type index ) const noexcept { return data_[index]; }
+
+		reference at( size_type index )
+		{
+			if ( index >= size_ )
+				throw std::out_of_range( "MappedVector::at() index out of range" );
+			return data_[index];
+		}
+
+		const_reference at( size_type index ) const
+		{ return const_cast<MappedVector*>(this)->at( index ); }
+
+		reference front() noexcept { return data_[0]; }
+		reference back() noexcept { return data_[size_ - 1U]; }
+
+		void reserve( size_type capacity )
+		{
+			if ( capacity > capacity_ )
+				remap( capacity );
+		}
+
+		void resize( size_type size )
+		{
+			reserve( size );
+			if ( size > size_ )
+				std::uninitialized_value_construct( data_ + size_, data_ + size );
+			size_ = size;
+		}
+
+		template< typename... Args >
+		reference emplace_back( Args&&... args )
+		{
+			if ( size_ == capacity_ )
+				grow();
+			T* item = std::construct_at( data_ + size_, std::forward<Args>(args)... );
+			++size_;
+			return *item;
+		}
+
+		void push_back( const T& value ) { emplace_back( value ); }
+		void push_back( T&& value ) { emplace_back( std::move(value) ); }
+
+		void pop_back() noexcept
+		{ --size_; }
+
+		/** Insert an element before @p pos moving the tail up with memmove */
+		iterator insert( const_iterator pos, T value )
+		{
+			const size_type index = static_cast<size_type>( pos - data_ );
+			if ( size_ == capacity_ )
+				grow();
+			std::memmove( static_cast<void*>(data_ + index + 1U), data_ + index, (size_ - index) * sizeof(T) );
+			std::construct_at( data_ + index, std::move(value) );
+			++size_;
+			return data_ + index;
+		}
+
+		/** Erase the element at @p pos moving the tail down with memmove */
+		iterator erase( const_iterator pos ) noexcept
+		{
+			const size_type index = static_cast<size_type>( pos - data_ );
+			std::memmove( static_cast<void*>(data_ + index), data_ + index + 1U, (size_ - index - 1U) * sizeof(T) );
+			--size_;
+			return data_ + index;
+		}
+
+		/** Remove all elements retaining the mapping */
+		void clear() noexcept
+		{ size_ = 0U; }
+
+		/** Hint that the elements are about to be read front-to-back
+		 * The kernel reads ahead aggressively and may drop pages soon after they are accessed.
+		 */
+		void adviseSequential() const noexcept
+		{
+			if ( data_ != nullptr && size_ != 0U )
+			{
+				const size_type bytes = size_ * sizeof(T);
+				::madvise( static_cast<void*>(data_), bytes, MADV_SEQUENTIAL );
+				::madvise( static_cast<void*>(data_), std::min<size_type>( bytes, MinimumBytes ), MADV_WILLNEED );
+			}
+		}
+
+	private:
+		void grow()
+		{ remap( std::max<size_type>( capacity_ * 2U, MinimumBytes / sizeof(T) ) ); }
+
+		/** Extend the backing file and map it at the new capacity */
+		void remap( size_type capacity )
+		{
+			const size_type pageSize = static_cast<size_type>( ::sysconf( _SC_PAGESIZE ) );
+			const size_type bytes = (capacity * sizeof(T) + pageSize - 1U) / pageSize * pageSize;
+
+			if ( fd_ < 0 )
+				fd_ = createFile();
+			if ( ::ftruncate( fd_, static_cast<off_t>(bytes) ) != 0 )
+				throw std::system_error( errno, std::generic_category(), "MappedVector ftruncate" );
+
+			void* region = MAP_FAILED;
+#if defined(__linux__)
+			region = (data_ != nullptr)
+				? ::mremap( data_, mappedBytes_, bytes, MREMAP_MAYMOVE )
+				: ::mmap( nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0 );
+#else
+			if ( data_ != nullptr )
+				::munmap( data_, mappedBytes_ );
+			region = ::mmap( nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0 );
+#endif
+			if ( region == MAP_FAILED )
+				throw std::system_error( errno, std::generic_category(), "MappedVector mmap" );
+
+			data_ = static_cast<T*>( region );
+			mappedBytes_ = bytes;
+			capacity_ = bytes / sizeof(T);
+		}
+
+		static int createFile()
+		{
+			std::string path = mappedFileDirectory() + "/subzeroecs-XXXXXX";
+			const int fd = ::mkstemp( path.data() );
+			if ( fd < 0 )
+				throw std::system_error( errno, std::generic_category(), "MappedVector mkstemp" );
+			::unlink( path.c_str() ); //< Released with the descriptor
+			return fd;
+		}
+
+		void release() noexcept
+		{
+			if ( data_ != nullptr )
+				::munmap( data_, mappedBytes_ );
+			if ( fd_ >= 0 )
+				::close( fd_ );
+			data_ = nullptr;
+			size_ = capacity_ = mappedBytes_ = 0U;
+			fd_ = -1;
+		}
+
+	private:
+		T* data_ = nullptr; //< Mapped elements
+		size_type size_ = 0U; //< Number of elements
+		size_type capacity_ = 0U; //< Elements that fit in the mapping
+		size_type mappedBytes_ = 0U; //< Size of the mapping and backing file
+		int fd_ = -1; //< Backing file descriptor
+	};
+
+} //END: Utility
+} //END: SubzeroECS
+
+#endif // defined(__unix__) || defined(__APPLE__)
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <algorithm> //< std::max, std::move, std::rotate
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory> //< std::allocator, std::destroy_n
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SubzeroECS {
+namespace Utility
+{
+	/** Segmented vector storing elements in fixed-size pages referenced by a page table
+	 *
+	 * Growth allocates a new page and never relocates existing elements, so element addresses remain
+	 * stable while appending (the common case as EntityIds are allocated incrementally).
+	 * Each page is contiguous so iteration can proceed page-wise over contiguous memory, @see page()
+	 *
+	 * @remark Inserting/erasing in the middle shifts the tail elements as with std::vector, but never
+	 *         reallocates so only the shifted elements are affected.
+	 * @tparam T  Element type
+	 * @tparam PageBytes  Target bytes per page, rounded down to a power-of-two element count (minimum 1)
+	 */
+	template< typename T, std::size_t PageBytes = 16U * 1024U >
+	class PagedVector
+	{
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+
+		static constexpr size_type PageSize = std::bit_floor( std::max<size_type>( PageBytes / sizeof(T), 1U ) ); //< Elements per page
+		static constexpr size_type PageShift = std::countr_zero( PageSize ); //< Index to page shift
+		static constexpr size_type PageMask = PageSize - 1U; //< Index to page offset mask
+
+		/** Random-access iterator addressing an element by index */
+		template< bool IsConst >
+		class BasicIterator
+		{
+		public:
+			using Owner = std::conditional_t<IsConst, const PagedVector, PagedVector>;
+
+			using iterator_category = std::random_access_iterator_tag;
+			using iterator_concept = std::random_access_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using reference = std::conditional_t<IsConst, const T&, T&>;
+			using pointer = std::conditional_t<IsConst, const T*, T*>;
+
+			BasicIterator() = default;
+			BasicIterator( Owner* owner, size_type index ) : owner_(owner), index_(index) {}
+
+			/** Implicit conversion of iterator to const_iterator */
+			operator BasicIterator<true>() const requires (!IsConst) { return BasicIterator<true>( owner_, index_ ); }
+
+			reference operator*() const { return (*owner_)[index_]; }
+			pointer operator->() const { return &(*owner_)[index_]; }
+			reference operator[]( difference_type n ) const { return (*owner_)[index_ + n]; }
+
+			BasicIterator& operator++() { ++index_; return *this; }
+			BasicIterator operator++(int) { BasicIterator tmp = *this; ++index_; return tmp; }
+			BasicIterator& operator--() { --index_; return *this; }
+			BasicIterator operator--(int) { BasicIterator tmp = *this; --index_; return tmp; }
+			BasicIterator& operator+=( difference_type n ) { index_ += n; return *this; }
+			BasicIterator& operator-=( difference_type n ) { index_ -= n; return *this; }
+
+			friend BasicIterator operator+( BasicIterator it, difference_type n ) { return it += n; }
+			friend BasicIterator operator+( difference_type n, BasicIterator it ) { return it += n; }
+			friend BasicIterator operator-( BasicIterator it, difference_type n ) { return it -= n; }
+			friend difference_type operator-( const BasicIterator& lhs, const BasicIterator& rhs )
+			{ return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_); }
+
+			friend bool operator==( const BasicIterator& lhs, const BasicIterator& rhs ) { return lhs.index_ == rhs.index_; }
+			friend auto operator<=>( const BasicIterator& lhs, const BasicIterator& rhs ) { return lhs.index_ <=> rhs.index_; }
+
+			/** Element index within the owning container */
+			size_type index() const { return index_; }
+
+		private:
+			Owner* owner_ = nullptr;
+			size_type index_ = 0U;
+		};
+
+		using iterator = BasicIterator<false>;
+		using const_iterator = BasicIterator<true>;
+
+	public:
+		PagedVector() = default;
+
+		PagedVector( const PagedVector& ) = delete;
+		PagedVector& operator=( const PagedVector& ) = delete;
+
+		PagedVector( PagedVector&& other ) noexcept
+			: pages_( std::move(other.pages_) )
+			, size_( std::exchange(other.size_, 0U) )
+		{}
+
+		PagedVector& operator=( PagedVector&& other ) noexcept
+		{
+			if ( this != &other )
+			{
+				release();
+				pages_ = std::move(other.pages_);
+				size_ = std::exchange(other.size_, 0U);
+			}
+			return *this;
+		}
+
+		~PagedVector()
+		{ release(); }
+
+		size_type size() const noexcept { return size_; }
+		bool empty() const noexcept { return size_ == 0U; }
+
+		/** Number of elements that can be held without allocating another page */
+		size_type capacity() const noexcept { return pages_.size() * PageSize; }
+
+		/** Allocate pages so that at least @p count elements can be held
+		@note Existing elements are never moved
+		*/
+		void reserve( size_type count )
+		{
+			while ( capacity() < count )
+				allocatePage();
+		}
+
+		reference operator[]( size_type index ) noexcept { return pages_[index >> PageShift][index & PageMask]; }
+		const_reference operator[]( size_type index ) const noexcept { return pages_[index >> PageShift][index & PageMask]; }
+
+		reference at( size_type index )
+		{
+			if ( index >= size_ )
+				throw std::out_of_range( "PagedVector::at() index out of range" );
+			return (*this)[index];
+		}
+
+		const_reference at( size_type index ) const
+		{
+			if ( index >= size_ )
+				throw std::out_of_range( "PagedVector::at() index out of range" );
+			return (*this)[index];
+		}
+
+		reference front() { return (*this)[0U]; }
+		reference back() { return (*this)[size_ - 1U]; }
+
+		iterator begin() noexcept { return iterator( this, 0U ); }
+		iterator end() noexcept { return iterator( this, size_ ); }
+		const_iterator begin() const noexcept { return const_iterator( this, 0U ); }
+		const_iterator end() const noexcept { return const_iterator( this, size_ ); }
+
+		/** Number of pages in use (i.e. containing at least one element) */
+		size_type pageCount() const noexcept { return (size_ + PageMask) >> PageShift; }
+
+		/** Contiguous elements stored in page @p iPage for page-wise iteration */
+		std::span<T> page( size_type iPage ) noexcept
+		{ return std::span<T>( pages_[iPage], std::min( PageSize, size_ - (iPage << PageShift) ) ); }
+
+		std::span<const T> page( size_type iPage ) const noexcept
+		{ return std::span<const T>( pages_[iPage], std::min( PageSize, size_ - (iPage << PageShift) ) ); }
+
+		template< typename... Args >
+		reference emplace_back( Args&&... args )
+		{
+			if ( size_ == capacity() )
+				allocatePage();
+
+			T* item = std::construct_at( &(*this)[size_], std::forward<Args>(args)... );
+			++size_;
+			return *item;
+		}
+
+		void push_back( const T& value ) { emplace_back( value ); }
+		void push_back( T&& value ) { emplace_back( std::move(value) ); }
+
+		void pop_back()
+		{
+			--size_;
+			std::destroy_at( &(*this)[size_] );
+		}
+
+		/** Insert an element before @p pos by appending and rotating the tail into place */
+		iterator insert( const_iterator pos, T&& value )
+		{
+			const size_type index = pos.index();
+			emplace_back( std::move(value) );
+			std::rotate( begin() + index, end() - 1, end() );
+			return begin() + index;
+		}
+
+		iterator insert( const_iterator pos, const T& value )
+		{ return insert( pos, T(value) ); }
+
+		/** Erase the element at @p pos shifting the tail down by one */
+		iterator erase( const_iterator pos )
+		{
+			const size_type index = pos.index();
+			std::move( begin() + index + 1, end(), begin() + index );
+			pop_back();
+			return begin() + index;
+		}
+
+		/** Destroy all elements retaining the allocated pages */
+		void clear() noexcept
+		{
+			for ( size_type iPage = 0U; iPage < pageCount(); ++iPage )
+			{
+				std::span<T> items = page(iPage);
+				std::destroy_n( items.data(), items.size() );
+			}
+			size_ = 0U;
+		}
+
+	private:
+		void allocatePage()
+		{
+			pages_.push_back( std::allocator<T>().allocate( PageSize ) );
+		}
+
+		void release() noexcept
+		{
+			clear();
+			for ( T* page : pages_ )
+				std::allocator<T>().deallocate( page, PageSize );
+			pages_.clear();
+		}
+
+	private:
+		std::vector<T*> pages_; //< Page table, each page holds PageSize elements
+		size_type size_ = 0U; //< Number of constructed elements
+	};
+
+} //END: Utility
+} //END: SubzeroECS
@@ -0,0 +1,25 @@
+#pragma once
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h> //< _mm_prefetch
+#endif
+
+namespace SubzeroECS {
+namespace Utility
+{
+	/** Hint that the cache line holding address will be read soon
+	 * @remark No-op where the compiler provides no prefetch intrinsic
+	 */
+	inline void prefetch( const void* address ) noexcept
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch( address );
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		_mm_prefetch( static_cast<const char*>(address), _MM_HINT_T0 );
+#else
+		(void)address;
+#endif
+	}
+
+} //END: Utility
+} //END: SubzeroECS
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring> //< std::memcpy, std::memmove
+
+namespace SubzeroECS {
+namespace Utility
+{
+	/** Move the last object of [first, last) to first, shifting the others up by one, by copying bytes
+	 * @warning Only for trivially relocatable T, the objects are not move constructed or destroyed
+	 */
+	template< typename T >
+	void relocateToFront( T* first, T* last ) noexcept
+	{
+		if ( last - first < 2 )
+			return;
+		alignas(T) std::byte buffer[sizeof(T)];
+		std::memcpy( buffer, static_cast<const void*>( last - 1 ), sizeof(T) );
+		std::memmove( static_cast<void*>( first + 1 ), static_cast<const void*>( first ), static_cast<std::size_t>( last - 1 - first ) * sizeof(T) );
+		std::memcpy( static_cast<void*>( first ), buffer, sizeof(T) );
+	}
+
+	/** Move the first object of [first, last) to the back, shifting the others down by one, by copying bytes
+	 * @warning Only for trivially relocatable T, the objects are not move constructed or destroyed
+	 */
+	template< typename T >
+	void relocateToBack( T* first, T* last ) noexcept
+	{
+		if ( last - first < 2 )
+			return;
+		alignas(T) std::byte buffer[sizeof(T)];
+		std::memcpy( buffer, static_cast<const void*>( first ), sizeof(T) );
+		std::memmove( static_cast<void*>( first ), static_cast<const void*>( first + 1 ), static_cast<std::size_t>( last - 1 - first ) * sizeof(T) );
+		std::memcpy( static_cast<void*>( last - 1 ), buffer, sizeof(T) );
+	}
+
+} //END: Utility
+} //END: SubzeroECS
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility> //< std::exchange
+#include <vector>
+
+namespace SubzeroECS {
+namespace Utility
+{
+	/** Fixed pool of worker threads running index ranges in parallel
+	 *
+	 * forEachIndex() splits the index range into one contiguous slice per thread with the calling thread
+	 * taking the first. A given index count always maps to the same thread, so work that is indexed
+	 * stably (e.g. a shard per index) keeps its affinity and stays warm in that core's cache between calls.
+	 * Tasks are passed by pointer and never allocated, so a call only costs a wake-up and a join.
+	 */
+	class ThreadPool
+	{
+	public:
+		/** @param threadCount  Total threads including the calling thread, 0 selects the hardware concurrency */
+		explicit ThreadPool( std::size_t threadCount = 0U )
+		{
+			if ( threadCount == 0U )
+			{
+				threadCount = std::max<std::size_t>( std::thread::hardware_concurrency(), 1U );
+			}
+
+			workers_.reserve( threadCount - 1U );
+			for ( std::size_t slot = 1U; slot < threadCount; ++slot )
+			{
+				workers_.emplace_back( [this, slot]() { workerLoop( slot ); } );
+			}
+		}
+
+		ThreadPool( const ThreadPool& ) = delete;
+		ThreadPool& operator=( const ThreadPool& ) = delete;
+
+		~ThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock( mutex_ );
+				stop_ = true;
+			}
+			wake_.notify_all();
+			for ( std::thread& worker : workers_ )
+			{
+				worker.join();
+			}
+		}
+
+		/// Number of threads including the calling thread
+		std::size_t size() const noexcept
+		{ return workers_.size() + 1U; }
+
+		/** Call func(index) for every index in [0, count) and wait for completion
+		 * @remark Rethrows the first exception thrown by func once all threads have finished, the remaining indices of the throwing thread are skipped
+		 * @warning Not reentrant, func must not call forEachIndex() on the same pool
+		 */
+		template< typename Func >
+		void forEachIndex( std::size_t count, Func&& func )
+		{
+			using FuncType = std::remove_reference_t<Func>;
+			run( count, []( void* context, std::size_t begin, std::size_t end )
+			{
+				FuncType& function = *static_cast<FuncType*>(context);
+				for ( std::size_t index = begin; index != end; ++index )
+				{
+					function( index );
+				}
+			}, const_cast<void*>(static_cast<const void*>(&func)) );
+		}
+
+	private:
+		using Task = void (*)( void* context, std::size_t begin, std::size_t end );
+
+		void run( std::size_t count, Task task, void* context )
+		{
+			if ( count == 0U )
+			{
+				return;
+			}
+
+			if ( workers_.empty() || count == 1U )
+			{
+				task( context, 0U, count );
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock( mutex_ );
+				task_ = task;
+				context_ = context;
+				count_ = count;
+				pending_ = workers_.size();
+				error_ = nullptr;
+				++generation_;
+			}
+			wake_.notify_all();
+
+			runSlice( 0U );
+
+			std::unique_lock<std::mutex> lock( mutex_ );
+			done_.wait( lock, [this]() { return pending_ == 0U; } );
+			if ( error_ )
+			{
+				std::rethrow_exception( std::exchange( error_, nullptr ) );
+			}
+		}
+
+		void runSlice( std::size_t slot )
+		{
+			const std::size_t threads = size();
+			const std::size_t begin = count_ * slot / threads;
+			const std::size_t end = count_ * (slot + 1U) / threads;
+			if ( begin == end )
+			{
+				return;
+			}
+
+			try
+			{
+				task_( context_, begin, end );
+			}
+			catch ( ... )
+			{
+				std::lock_guard<std::mutex> lock( mutex_ );
+				if ( !error_ )
+				{
+					error_ = std::current_exception();
+				}
+			}
+		}
+
+		void workerLoop( std::size_t slot )
+		{
+			std::uint64_t generation = 0U;
+			for (;;)
+			{
+				{
+					std::unique_lock<std::mutex> lock( mutex_ );
+					wake_.wait( lock, [&]() { return stop_ || generation_ != generation; } );
+					if ( stop_ )
+					{
+						return;
+					}
+					generation = generation_;
+				}
+
+				runSlice( slot );
+
+				bool finished = false;
+				{
+					std::lock_guard<std::mutex> lock( mutex_ );
+					finished = (--pending_ == 0U);
+				}
+				if ( finished )
+				{
+					done_.notify_one();
+				}
+			}
+		}
+
+	private:
+		std::vector<std::thread> workers_; //< Worker threads for slots 1..N, the caller runs slot 0
+		std::mutex mutex_; //< Guards the task state below
+		std::condition_variable wake_; //< Signals workers of a new generation or stop
+		std::condition_variable done_; //< Signals the caller that all workers finished
+		Task task_ = nullptr; //< Current task
+		void* context_ = nullptr; //< Argument of the current task
+		std::size_t count_ = 0U; //< Index count of the current task
+		std::size_t pending_ = 0U; //< Workers yet to finish the current task
+		std::uint64_t generation_ = 0U; //< Incremented per task to wake workers
+		std::exception_ptr error_; //< First exception thrown by the current task
+		bool stop_ = false; //< Set at destruction to end the workers
+	};
+
+} //END: Utility
+} //END: SubzeroECS
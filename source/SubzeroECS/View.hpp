@@ -2,10 +2,20 @@
 
 #include <algorithm> //< std::all_of, std::distance
 #include <array>
+#include <cstddef>
+#include <iterator> //< std::contiguous_iterator
+#include <limits>
+#include <ranges>
+#include <span>
 #include <tuple>
+#include <type_traits>
+#include <variant> //< std::monostate
+#include <vector>
 
 #include "Collection.hpp"
 #include "Intersection.hpp"
+#include "StaticWorld.hpp"
+#include "Utility/CallableTraits.hpp"
 
 template <typename T, typename... Ts> struct get_type_index;
 
@@ -27,6 +37,267 @@ using Bare = typename std::remove_cv<typename std::remove_reference<T>::type>::t
 
 namespace SubzeroECS
 {
+	namespace Detail
+	{
+		/** Indexed access to a non-contiguous component column e.g. PagedVector */
+		template< typename Column >
+		struct ColumnRef
+		{
+			Column* column;
+			auto& operator[]( std::size_t index ) const { return (*column)[index]; }
+		};
+
+		/** Hoist the base of a component column for repeated indexed access
+		@return Raw data pointer for contiguous columns otherwise a ColumnRef
+		*/
+		template< typename Column >
+		auto columnBase( Column& column )
+		{
+			if constexpr ( std::contiguous_iterator<typename Column::iterator> )
+				return column.data();
+			else
+				return ColumnRef<Column>{ &column };
+		}
+
+		/** Hoisted id and component column bases shared by ViewEntity handles */
+		template< typename... Components >
+		struct ViewColumns
+		{
+			using Bases = std::tuple< decltype( columnBase( std::declval<typename Collection<Components>::ComponentVector&>() ) )... >;
+
+			const EntityId* ids = nullptr; ///< Ids of the first component column
+			Bases bases; ///< Column base of each component
+		};
+	} //END: Detail
+
+	/** Iterator for a View performing set-intersection over all component collections
+	 * @remark Supports structured bindings of the components e.g. `for ( auto [position, velocity] : view )`
+	 */
+	template< typename... Components >
+	class ViewIterator
+	{
+	public:
+		using Collections = std::tuple< Collection<Components>&... >; ///< All component collections
+		using Iterators = std::tuple< typename Collection<Components>::Iterator... >; ///< All component iterators
+		using GroupRow = std::array<std::uint32_t, sizeof...(Components)>; ///< @see Group::Row
+
+		ViewIterator( Collections& collections, Iterators&& iterators )
+		   : collections_( collections)
+			, iterators_( std::move(iterators) )
+		{
+			// Find first valid intersection
+			if constexpr (sizeof...(Components) == 1)
+			{
+				// Single component - already at first element or end
+			}
+			else
+			{
+				begin( std::make_index_sequence<sizeof...(Components)>{} );
+			}
+		}
+
+		/** Construct iterator walking the rows of an owning Group */
+		ViewIterator( Collections& collections, const GroupRow* row, const GroupRow* rowEnd )
+		   : collections_( collections)
+			, iterators_( makeEndIterators( collections, std::make_index_sequence<sizeof...(Components)>{} ) )
+			, row_( row )
+			, rowEnd_( rowEnd )
+		{
+			seekRow( std::make_index_sequence<sizeof...(Components)>{} );
+		}
+
+		template< typename Component>
+		Component& get() const
+		{
+			static constexpr uint32_t iComponent = get_type_index<Component, Components...>::value;
+			return std::get<iComponent>(collections_).at( 
+				std::get<iComponent>(iterators_) );
+		}
+
+		template< typename Component>
+		bool has() const
+		{
+			static constexpr uint32_t iComponent = get_type_index<Component, Components...>::value;
+			auto it = std::get<iComponent>(iterators_);
+			auto iend = std::get<iComponent>(collections_).end();
+			return it != iend && *it == this->operator EntityId();
+		}
+
+		ViewIterator& operator++()
+		{
+			// Incrementing at end is an error
+			assert(std::get<0>(iterators_) != std::get<0>(collections_).end());
+
+			if constexpr (sizeof...(Components) == 1)
+			{
+				// Single component - just advance the iterator
+				++std::get<0>(iterators_);
+			}
+			else if ( row_ != nullptr )
+			{
+				// Owning group - step to the next row, no intersection required
+				++row_;
+				seekRow( std::make_index_sequence<sizeof...(Components)>{} );
+			}
+			else
+			{
+				increment( std::make_index_sequence<sizeof...(Components)>{} );
+			}
+			return *this;
+		}
+
+		bool operator != ( const ViewIterator& rhs ) const
+		{ 
+			//TODO: We could want a deeper test for consistency in debug?
+			return std::get<0>(iterators_) != std::get<0>(rhs.iterators_); 
+		}
+
+		bool operator == ( const ViewIterator& rhs ) const
+		{ 
+			//TODO: We could want a deeper test for consistency in debug?
+			return std::get<0>(iterators_) == std::get<0>(rhs.iterators_); 
+		}
+
+		operator EntityId() const
+		{ 
+			auto iEntity = std::get<0U>(iterators_);
+			return *iEntity;
+		}
+
+		ViewIterator& operator*()
+		{
+			return *this;
+		}
+
+		/** Position in each component collection */
+		const Iterators& iterators() const noexcept
+		{ return iterators_; }
+
+		/** Current owning group row or nullptr when intersecting */
+		const GroupRow* row() const noexcept
+		{ return row_; }
+
+		/** Structured binding access to the I'th component */
+		template< std::size_t I >
+		friend auto& get( const ViewIterator& iEntity )
+		{
+			return iEntity.template get< std::tuple_element_t<I, std::tuple<Components...>> >();
+		}
+
+	private:
+
+		template<std::size_t... Is>
+		static Iterators makeEndIterators( Collections& collections, std::index_sequence<Is...> )
+		{
+			return Iterators( std::get<Is>(collections).end()... );
+		}
+
+		/** Position all iterators at the current group row or at end once rows are exhausted */
+		template<std::size_t... Is>
+		void seekRow( std::index_sequence<Is...> )
+		{
+			if ( row_ != rowEnd_ )
+			{
+				((std::get<Is>(iterators_) = std::get<Is>(collections_).begin() + (*row_)[Is]), ...);
+			}
+			else
+			{
+				std::get<0>(iterators_) = std::get<0>(collections_).end();
+			}
+		}
+
+		/** Helper for N-way intersection - find first intersection */
+		template<std::size_t... Is>
+		void begin( std::index_sequence<Is...> indices )
+		{
+			auto endIterators = std::make_tuple(std::get<Is>(collections_).end()...);
+			if (!Intersection::beginN(indices, iterators_, endIterators))
+			{
+				// No intersection found - set first iterator to end
+				std::get<0>(iterators_) = std::get<0>(endIterators);
+			}
+		}
+
+		/** Helper for N-way intersection - increment and find next */
+		template<std::size_t... Is>
+		void increment( std::index_sequence<Is...> indices )
+		{
+			auto endIterators = std::make_tuple(std::get<Is>(collections_).end()...);
+			if (!Intersection::incrementN(indices, iterators_, endIterators))
+			{
+				// No intersection found - set first iterator to end
+				std::get<0>(iterators_) = std::get<0>(endIterators);
+			}
+		}
+
+	private:
+		Collections collections_;
+		Iterators iterators_;
+		const GroupRow* row_ = nullptr; ///< Current owning group row, nullptr when intersecting
+		const GroupRow* rowEnd_ = nullptr; ///< End of owning group rows
+	};
+
+	/** Handle to a single entity of a View addressed by its position in each component column
+	 * @remark Supports structured bindings of the components e.g. `[]( auto entity ) { auto [position, velocity] = entity; }`
+	 */
+	template< typename... Components >
+	class ViewEntity
+	{
+	public:
+		using Columns = Detail::ViewColumns<Components...>;
+		using Row = std::array<std::uint32_t, sizeof...(Components)>; ///< Position in each component column
+
+		ViewEntity( const Columns* columns, const Row& row ) noexcept
+			: columns_( columns )
+			, row_( row )
+		{}
+
+		EntityId id() const noexcept
+		{ return columns_->ids[row_[0]]; }
+
+		operator EntityId() const noexcept
+		{ return id(); }
+
+		template< typename Component >
+		Component& get() const
+		{
+			static constexpr uint32_t iComponent = get_type_index<Component, Components...>::value;
+			return std::get<iComponent>(columns_->bases)[row_[iComponent]];
+		}
+
+		/** Structured binding access to the I'th component */
+		template< std::size_t I >
+		friend auto& get( const ViewEntity& entity )
+		{
+			return entity.template get< std::tuple_element_t<I, std::tuple<Components...>> >();
+		}
+
+	private:
+		const Columns* columns_;
+		Row row_;
+	};
+
+	namespace Detail
+	{
+		/** Random-access range returned by View::rows()
+		 * Entity handles of multi-component views are materialized so the iterators are plain pointers
+		 */
+		template< typename... Components >
+		struct ViewRows
+		{
+			using type = std::span< const ViewEntity<Components...> >;
+		};
+
+		/** Single component views expose the column itself, a span when it is contiguous */
+		template< typename Component >
+		struct ViewRows<Component>
+		{
+			using ColumnIterator = typename Collection<Component>::ComponentVector::iterator;
+			using type = std::conditional_t< std::contiguous_iterator<ColumnIterator>
+				, std::span<Component>, std::ranges::subrange<ColumnIterator> >;
+		};
+	} //END: Detail
+
 	/** Creates a union view for ECS-entities with the selected components 
 	 * @tparam Components  The components that will be iterated over to find ECS-entities containing all
 						   Each type can  define required access pattern using standard C++ language as follows:
@@ -50,6 +321,9 @@ namespace SubzeroECS
 
 		using ViewIterationState = std::tuple<std::pair< Collection<Components>&, typename Collection<Components>::Iterator >...>;
 
+		/// Owning group rows used in place of intersection when a Collection<Components...> exists
+		using GroupRow = std::array<std::uint32_t, sizeof...(Components)>; ///< @see Group::Row
+
 		/** Get the current iteration state */
 		template<std::size_t... Is>
 		static ViewIterationState makeIterationStateImpl( Collections& collections, Iterators& iterators, std::index_sequence<Is...> )
@@ -66,140 +340,339 @@ namespace SubzeroECS
 		}
 
 		/** Iterator for the view performing set-intersection over all component collections */
-		class Iterator
+		using Iterator = ViewIterator<Components...>;
+
+		/** Column positions (or group row position) to gallop from, @see seek() */
+		using SeekHints = std::array<std::size_t, sizeof...(Components)>;
+
+		/** Random-access range over the view rows, @see rows() */
+		using Rows = typename Detail::ViewRows<Components...>::type;
+		using RowIterator = std::ranges::iterator_t<Rows>;
+
+	public:
+		/** @note C++11 std::make_tuple
+		*/
+		View( CollectionRegistry& registry )
+			: collections_( (sizeof( Components ), registry.get<Components>() )... )
+			, localGroup_( makeLocalGroup() )
 		{
-		public:
-			Iterator( Collections& collections, Iterators&& iterators )
-			   : collections_( collections)
-				, iterators_( std::move(iterators) )
+			if constexpr (sizeof...(Components) > 1)
 			{
-				// Find first valid intersection
-				if constexpr (sizeof...(Components) == 1)
-				{
-					// Single component - already at first element or end
-				}
-				else
+				Collection<Components...>* owner = registry.find<Components...>();
+				group_ = (owner != nullptr) ? &owner->group() : nullptr;
+			}
+		}
+
+		/** Construct view over a StaticWorld resolving all collections at compile-time
+		*/
+		template< typename... WorldComponents >
+		View( StaticWorld<WorldComponents...>& world )
+			: collections_( world.template get<Components>()... )
+			, localGroup_( makeLocalGroup() )
+		{
+		}
+
+		/** @note Uses C++14 std::get<>
+		*/
+		template< typename Component>
+		Collection<Component>& getCollection()
+		{
+			static constexpr uint_fast32_t iComponent = get_type_index<Component,Components...>::value;
+			return std::get<iComponent>(collections_);
+		}
+
+		/** TODO */
+		Iterator begin() 
+		{ 
+			(getCollection<Components>().adviseSequential(), ...);
+			if constexpr (sizeof...(Components) > 1)
+			{
+				if ( group_ != nullptr )
 				{
-					begin( std::make_index_sequence<sizeof...(Components)>{} );
+					const auto& rows = group_->sync();
+					return Iterator( collections_, rows.data(), rows.data() + rows.size() );
 				}
 			}
+			return Iterator( collections_, Iterators( getCollection<Components>().begin()...) );
+		}
+		
+		/** TODO */
+		Iterator end() 
+		{ return Iterator( collections_, Iterators( getCollection<Components>().end()... )  ); }
+
+		/** Iterator at the first entity whose id is not less than @p entityId
+		 * Each column, or the owning group rows, is searched by galloping from the positions in @p hints so
+		 * resuming near a previous iterator, @see seekHints(), costs O(log distance) and remains correct after
+		 * entities were added or removed in between.
+		 */
+		Iterator seek( EntityId entityId, const SeekHints& hints = {} )
+		{
+			return seekImpl( entityId, hints, std::index_sequence_for<Components...>{} );
+		}
 
-			template< typename Component>
-			Component& get()
+		/** Positions of an iterator to pass as seek() hints */
+		SeekHints seekHints( const Iterator& iEntity )
+		{
+			return seekHintsImpl( iEntity, std::index_sequence_for<Components...>{} );
+		}
+
+		/** Number of entities in the view
+		 * Single component views return the collection size in O(1), grouped views the group size, otherwise
+		 * the intersection runs over the raw ids without touching component data.
+		 */
+		std::size_t count()
+		{
+			if constexpr (sizeof...(Components) == 1)
 			{
-				static const uint32_t iComponent = get_type_index<Component, Components...>::value;
-				return std::get<iComponent>(collections_).at( 
-					std::get<iComponent>(iterators_) );
+				return std::get<0>(collections_).size();
 			}
+			else
+			{
+				if ( group_ != nullptr )
+					return group_->sync().size();
+				return countIds( std::numeric_limits<std::size_t>::max(), std::index_sequence_for<Components...>{} );
+			}
+		}
 
-			template< typename Component>
-			bool has()
+		/** True if no entity has all the view components, exiting at the first intersection found */
+		bool empty()
+		{
+			if constexpr (sizeof...(Components) == 1)
 			{
-				static const uint32_t iComponent = get_type_index<Component, Components...>::value;
-				auto it = std::get<iComponent>(iterators_);
-				auto iend = std::get<iComponent>(collections_).end();
-				return it != iend && *it == this->operator EntityId();
+				return std::get<0>(collections_).size() == 0U;
 			}
+			else
+			{
+				if ( group_ != nullptr )
+					return group_->sync().empty();
+				return countIds( 1U, std::index_sequence_for<Components...>{} ) == 0U;
+			}
+		}
 
-			Iterator& operator++()
+		/** Random-access range over the view entities for std::ranges and parallel algorithms e.g.
+		 * @code
+		 * auto rows = view.rows();
+		 * std::for_each( std::execution::par_unseq, rows.begin(), rows.end(), []( auto entity ) { ... } );
+		 * @endcode
+		 * Single component views return the component column itself, a std::span when it is contiguous.
+		 * Other views return a span of ViewEntity handles filled from the rows of the owning group, or of a
+		 * Group private to the view which is re-synced incrementally on later calls.
+		 * @warning Invalidated when entities of the view components are added or removed
+		 * @warning The iterators refer to the view, which must outlive them and not be moved or copied from
+		 *          while they are in use, hence rows() of a temporary view is deleted
+		 */
+		Rows rows() &
+		{
+			if constexpr (sizeof...(Components) == 1)
 			{
-				// Incrementing at end is an error
-				assert(std::get<0>(iterators_) != std::get<0>(collections_).end());
+				auto& components = std::get<0>(collections_).components();
+				return Rows( components.begin(), components.end() );
+			}
+			else
+			{
+				columns_ = makeColumns( std::index_sequence_for<Components...>{} );
+				GroupType* group = (group_ != nullptr) ? group_ : &localGroup_;
+				const auto& rows = group->sync();
+				entities_.clear();
+				entities_.reserve( rows.size() );
+				for ( const GroupRow& row : rows )
+					entities_.emplace_back( &columns_, row );
+				return Rows( entities_ );
+			}
+		}
 
-				if constexpr (sizeof...(Components) == 1)
-				{
-					// Single component - just advance the iterator
-					++std::get<0>(iterators_);
-				}
-				else
+		Rows rows() && = delete;
+
+		/** Owning group used for iteration or nullptr if components are intersected */
+		auto* group() const noexcept
+		{ return group_; }
+
+		/** Invoke @p func for every entity in the view using internal iteration
+		 * Parameters of a non-generic callable are matched to components by type so access is deduced from
+		 * the signature, an EntityId parameter receives the entity id. Generic callables receive the
+		 * components in View order, optionally preceded by the EntityId.
+		 * @code
+		 * view.each( []( Position& position, const Velocity& velocity ) { ... } );
+		 * @endcode
+		 * @remark Column base pointers are hoisted and intersection runs over raw id arrays which the
+		 *         optimizer keeps in registers, unlike the Iterator state
+		 */
+		template< typename Func >
+		void each( Func&& func )
+		{
+			eachAs< typename Utility::CallableTraits<std::remove_cvref_t<Func>>::Arguments >( func );
+		}
+
+		/** @see each() with parameters given by @p Arguments as std::tuple<Args...>, void for View order */
+		template< typename Arguments, typename Func >
+		void eachAs( Func&& func )
+		{
+			eachImpl<Arguments>( func, std::index_sequence_for<Components...>{} );
+		}
+
+	private:
+
+		template< std::size_t... Is >
+		Iterator seekImpl( EntityId entityId, const SeekHints& hints, std::index_sequence<Is...> )
+		{
+			if constexpr (sizeof...(Components) > 1)
+			{
+				if ( group_ != nullptr )
 				{
-					increment( std::make_index_sequence<sizeof...(Components)>{} );
+					const auto& rows = group_->sync();
+					const EntityId* const ids = std::get<0>(collections_).ids().data();
+					const std::size_t iRow = Intersection::gallopLowerBound( rows.size(), hints[0], entityId
+						, [&]( std::size_t i ) { return ids[rows[i][0]]; } );
+					return Iterator( collections_, rows.data() + iRow, rows.data() + rows.size() );
 				}
-				return *this;
 			}
+			return Iterator( collections_, Iterators( (std::get<Is>(collections_).begin() + static_cast<std::ptrdiff_t>( seekColumn<Is>( entityId, hints[Is] ) ))... ) );
+		}
 
-			bool operator != ( const Iterator& rhs ) const
-			{ 
-				//TODO: We could want a deeper test for consistency in debug?
-				return std::get<0>(iterators_) != std::get<0>(rhs.iterators_); 
-			}
+		template< std::size_t I >
+		std::size_t seekColumn( EntityId entityId, std::size_t hint ) const
+		{
+			const auto& ids = std::get<I>(collections_).ids();
+			return Intersection::gallopLowerBound( ids.size(), hint, entityId, [&]( std::size_t i ) { return ids[i]; } );
+		}
 
-			bool operator == ( const Iterator& rhs ) const
-			{ 
-				//TODO: We could want a deeper test for consistency in debug?
-				return std::get<0>(iterators_) == std::get<0>(rhs.iterators_); 
+		template< std::size_t... Is >
+		SeekHints seekHintsImpl( const Iterator& iEntity, std::index_sequence<Is...> )
+		{
+			if constexpr (sizeof...(Components) > 1)
+			{
+				if ( iEntity.row() != nullptr )
+					return SeekHints{ static_cast<std::size_t>( iEntity.row() - group_->sync().data() ) };
 			}
+			return SeekHints{ static_cast<std::size_t>( std::get<Is>(iEntity.iterators()) - std::get<Is>(collections_).begin() )... };
+		}
 
-			operator EntityId() const
-			{ 
-				auto iEntity = std::get<0U>(iterators_);
-				return *iEntity;
-			}
+		template< std::size_t... Is >
+		Detail::ViewColumns<Components...> makeColumns( std::index_sequence<Is...> )
+		{
+			return { std::get<0>(collections_).ids().data()
+				, typename Detail::ViewColumns<Components...>::Bases( Detail::columnBase( std::get<Is>(collections_).components() )... ) };
+		}
+
+		/** Count intersecting ids stopping once @p limit is reached */
+		template< std::size_t... Is >
+		std::size_t countIds( std::size_t limit, std::index_sequence<Is...> indices ) const
+		{
+			const EntityId* const ids[] = { std::get<Is>(collections_).ids().data()... };
+			auto iterators = std::make_tuple( ids[Is]... );
+			const auto endIterators = std::make_tuple( (ids[Is] + std::get<Is>(collections_).size())... );
 
-			Iterator& operator*()
+			std::size_t result = 0U;
+			if ( Intersection::beginN( indices, iterators, endIterators ) )
 			{
-				return *this;
+				do
+				{
+					if ( ++result == limit )
+						break;
+				}
+				while ( Intersection::incrementN( indices, iterators, endIterators ) );
 			}
+			return result;
+		}
 
-		private:
+		template< typename Arguments, typename Func, std::size_t... Is >
+		void eachImpl( Func& func, std::index_sequence<Is...> indices )
+		{
+			(std::get<Is>(collections_).adviseSequential(), ...);
+			auto columns = std::make_tuple( Detail::columnBase( std::get<Is>(collections_).components() )... );
+			const EntityId* const ids[] = { std::get<Is>(collections_).ids().data()... };
 
-			/** Helper for N-way intersection - find first intersection */
-			template<std::size_t... Is>
-			void begin( std::index_sequence<Is...> indices )
+			if constexpr (sizeof...(Components) == 1)
 			{
-				auto endIterators = std::make_tuple(std::get<Is>(collections_).end()...);
-				if (!Intersection::beginN(indices, iterators_, endIterators))
+				const std::size_t count = std::get<0>(collections_).size();
+				for ( std::size_t i = 0U; i < count; ++i )
 				{
-					// No intersection found - set first iterator to end
-					std::get<0>(iterators_) = std::get<0>(endIterators);
+					invoke<Arguments>( func, columns, ids[0][i], std::array<std::size_t, 1U>{ i }, indices );
 				}
 			}
-
-			/** Helper for N-way intersection - increment and find next */
-			template<std::size_t... Is>
-			void increment( std::index_sequence<Is...> indices )
+			else
 			{
-				auto endIterators = std::make_tuple(std::get<Is>(collections_).end()...);
-				if (!Intersection::incrementN(indices, iterators_, endIterators))
+				if ( group_ != nullptr )
+				{
+					for ( const GroupRow& row : group_->sync() )
+					{
+						invoke<Arguments>( func, columns, ids[0][row[0]], row, indices );
+					}
+					return;
+				}
+
+				auto iterators = std::make_tuple( ids[Is]... );
+				const auto endIterators = std::make_tuple( (ids[Is] + std::get<Is>(collections_).size())... );
+				if ( Intersection::beginN( indices, iterators, endIterators ) )
 				{
-					// No intersection found - set first iterator to end
-					std::get<0>(iterators_) = std::get<0>(endIterators);
+					do
+					{
+						invoke<Arguments>( func, columns, *std::get<0>(iterators),
+							std::array<std::size_t, Size>{ static_cast<std::size_t>(std::get<Is>(iterators) - ids[Is])... }, indices );
+					}
+					while ( Intersection::incrementN( indices, iterators, endIterators ) );
 				}
 			}
+		}
 
-		private:
-			Collections collections_;
-			Iterators iterators_;
-		};
+		template< typename Arguments, typename Func, typename Columns, typename Indices, std::size_t... Is >
+		static void invoke( Func& func, Columns& columns, EntityId entityId, const Indices& index, std::index_sequence<Is...> )
+		{
+			if constexpr ( !std::is_void_v<Arguments> )
+			{
+				invokeArguments( func, columns, entityId, index, static_cast<Arguments*>(nullptr) );
+			}
+			else if constexpr ( std::is_invocable_v<Func&, EntityId, Components&...> )
+			{
+				func( entityId, std::get<Is>(columns)[index[Is]]... );
+			}
+			else
+			{
+				func( std::get<Is>(columns)[index[Is]]... );
+			}
+		}
 
-	public:
-		/** @note C++11 std::make_tuple
-		*/
-		View( CollectionRegistry& registry )
-			: collections_( (sizeof( Components ), registry.get<Components>() )... )
+		template< typename Func, typename Columns, typename Indices, typename... Args >
+		static void invokeArguments( Func& func, Columns& columns, EntityId entityId, const Indices& index, std::tuple<Args...>* )
 		{
+			func( argument<Args>( columns, entityId, index )... );
 		}
 
-		/** @note Uses C++14 std::get<>
-		*/
-		template< typename Component>
-		Collection<Component>& getCollection()
+		/** Resolve a callable parameter to the EntityId or the component of matching type */
+		template< typename Arg, typename Columns, typename Indices >
+		static decltype(auto) argument( Columns& columns, EntityId entityId, const Indices& index )
 		{
-			static constexpr uint_fast32_t iComponent = get_type_index<Component,Components...>::value;
-			return std::get<iComponent>(collections_);
+			if constexpr ( std::is_same_v<Bare<Arg>, EntityId> )
+			{
+				return entityId;
+			}
+			else
+			{
+				constexpr std::size_t iComponent = get_type_index<Bare<Arg>, Components...>::value;
+				return (std::get<iComponent>(columns)[index[iComponent]]);
+			}
 		}
 
-		/** TODO */
-		Iterator begin() 
-		{ 
-			return Iterator( collections_, Iterators( getCollection<Components>().begin()...) );
+		using GroupType = std::conditional_t< (sizeof...(Components) > 1U), Group<Components...>, void >;
+
+		using LocalGroup = std::conditional_t< (sizeof...(Components) > 1U), Group<Components...>, std::monostate >;
+
+		using RowEntities = std::conditional_t< (sizeof...(Components) > 1U), std::vector< ViewEntity<Components...> >, std::monostate >;
+
+		/** Group over the view collections, only synced when rows() finds no owning group */
+		LocalGroup makeLocalGroup()
+		{
+			if constexpr (sizeof...(Components) > 1U)
+				return std::make_from_tuple<LocalGroup>( collections_ );
+			else
+				return {};
 		}
-		
-		/** TODO */
-		Iterator end() 
-		{ return Iterator( collections_, Iterators( getCollection<Components>().end()... )  ); }
-	private:
+
 		Collections collections_;
+		GroupType* group_ = nullptr; ///< Owning group from Collection<Components...> if registered
+		LocalGroup localGroup_; ///< Group synced by rows() when there is no owning group
+		Detail::ViewColumns<Components...> columns_; ///< Column bases referenced by rows() entities
+		RowEntities entities_; ///< Entity handles of the last rows(), capacity kept between calls
 	};
 
 	/** Specialization of View for zero components - represents an empty view
@@ -231,6 +704,33 @@ namespace SubzeroECS
 
 		Iterator begin() const { return Iterator{}; }
 		Iterator end() const { return Iterator{}; }
+
+		std::size_t count() const { return 0U; }
+		bool empty() const { return true; }
 	};
 
-} //END: SubzeroECS
\ No newline at end of file
+} //END: SubzeroECS
+
+/** Tuple protocol for structured bindings of SubzeroECS::ViewIterator components */
+template< typename... Components >
+struct std::tuple_size< SubzeroECS::ViewIterator<Components...> >
+	: std::integral_constant<std::size_t, sizeof...(Components)>
+{};
+
+template< std::size_t I, typename... Components >
+struct std::tuple_element< I, SubzeroECS::ViewIterator<Components...> >
+{
+	using type = std::tuple_element_t<I, std::tuple<Components...>>&;
+};
+
+/** Tuple protocol for structured bindings of SubzeroECS::ViewEntity components */
+template< typename... Components >
+struct std::tuple_size< SubzeroECS::ViewEntity<Components...> >
+	: std::integral_constant<std::size_t, sizeof...(Components)>
+{};
+
+template< std::size_t I, typename... Components >
+struct std::tuple_element< I, SubzeroECS::ViewEntity<Components...> >
+{
+	using type = std::tuple_element_t<I, std::tuple<Components...>>&;
+};
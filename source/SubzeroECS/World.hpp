@@ -1,10 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <map>
+#include <span>
+#include <stdexcept>
+#include <tuple>
 #include <utility> //< std::forward
+#include <vector>
 
 #include "Entity.hpp"
 #include "CollectionRegistry.hpp"
+#include "Intersection.hpp"
+#include "Prefab.hpp"
+#include "Query.hpp"
 
 namespace SubzeroECS
 {
@@ -21,6 +31,23 @@ namespace SubzeroECS
 			return Entity( *this, entityId );
 		} 
 
+		/** Reserve ids for count new entities without adding any components
+		 * The ids are consecutive and above every existing id, so bulk-added components are appended to the
+		 * collections, @see Collection::createMany()
+		 * @return First id of the range, the remaining ids follow in order
+		 * @throw std::overflow_error if the ids would exceed the EntityId range
+		 */
+		EntityId createRange( std::size_t count )
+		{
+			const EntityId first = lastEntityId_.next();
+			if ( count == 0U )
+				return first;
+			if ( count - 1U >= static_cast<std::size_t>( EntityId::Invalid.value - first.value ) )
+				throw std::overflow_error( "EntityId range overflow for call to createRange()" );
+			lastEntityId_ = EntityId{ static_cast<std::uint32_t>( first.value + (count - 1U) ) };
+			return first;
+		}
+
 		template<typename... Components>
 		Entity create(Components&&... items)
 		{
@@ -29,6 +56,32 @@ namespace SubzeroECS
 			return Entity( *this, entityId );
 		}
 
+		/** Spawn count copies of a prefab with a single reserve and fill of each component column
+		 * @return Ids of the instances, consecutive and above every existing id
+		 */
+		template<typename... Components>
+		EntityRange instantiate( const Prefab<Components...>& prefab, std::size_t count )
+		{ return instantiate( prefab, count, []( EntityId, Components&... ) {} ); }
+
+		/** Spawn count copies of a prefab, calling init(EntityId, Components&...) to customise each instance */
+		template<typename... Components, typename InitFn>
+		EntityRange instantiate( const Prefab<Components...>& prefab, std::size_t count, InitFn&& init )
+		{
+			const EntityRange entities{ createRange( count ), count };
+			Detail::instantiatePrefab( prefab, entities, init, CollectionRegistry::get<Components>()... );
+			return entities;
+		}
+
+		/** Remove every entity and restart EntityIds from the first id, e.g. on a level restart
+		 * The collections stay registered and keep their allocations, so the world refills without allocating.
+		 * @warning Entity handles and EntityIds from before the clear refer to the new entities reusing their ids
+		 */
+		void clear() noexcept
+		{
+			CollectionRegistry::clearCollections();
+			lastEntityId_ = EntityId::Invalid;
+		}
+
 		template<typename Component>
 		void add( EntityId entityId, const Component& item )
 		{
@@ -41,6 +94,16 @@ namespace SubzeroECS
 			CollectionRegistry::get<Component>().create(entityId, std::forward<Component>(item));
 		}
 
+		/** Remove a component from an entity
+		@return false if the entity did not have the component
+		*/
+		template<typename Component>
+		bool remove( EntityId entityId )
+		{
+			Collection<Component>* collection = CollectionRegistry::find<Component>();
+			return (collection != nullptr) && collection->remove(entityId);
+		}
+
 		template<typename Component>
 		bool has( EntityId entityId )
 		{ 
@@ -59,8 +122,143 @@ namespace SubzeroECS
 		Component& get( EntityId entityId )
 		{ return CollectionRegistry::get<Component>().get(entityId); }
 
+		/** Get pointers to the components of many entities at once
+		 * Faster than repeated get() for reference-following systems (targets, parents, collision partners)
+		 * as the lookups are resolved in one ordered pass over the collection, @see Collection::findMany()
+		 * @param[out] components  Receives the component of entityIds[i] at components[i], or nullptr if the entity has none
+		 */
+		template<typename Component>
+		void getMany( std::span<const EntityId> entityIds, std::span<Component*> components )
+		{ CollectionRegistry::get<Component>().findMany(entityIds, components); }
+
+		/** Count entities matching a query object e.g. world.count( Has<Human>() && (Has<Health>() > Health{50}) )
+		 * Only entities of the smallest collection required by the query are evaluated, @see QueryComponents
+		 * @remark Queries of Has<> alone are counted by intersecting the collection ids, @see QueryIdsOnly
+		 */
+		template<class QueryObject>
+		std::size_t count( const QueryObject& queryObject )
+		{
+			if constexpr ( QueryIdsOnly<QueryObject>::value )
+			{
+				return countIds( std::numeric_limits<std::size_t>::max(), static_cast<QueryComponents_t<QueryObject>*>(nullptr) );
+			}
+			else
+			{
+				std::size_t result = 0U;
+				eachCandidate( [&]( const Entity& entity )
+				{
+					result += queryObject(entity) ? 1U : 0U;
+					return true;
+				}, static_cast<QueryComponents_t<QueryObject>*>(nullptr) );
+				return result;
+			}
+		}
+
+		/** True if any entity matches a query object, exiting at the first match */
+		template<class QueryObject>
+		bool any( const QueryObject& queryObject )
+		{
+			if constexpr ( QueryIdsOnly<QueryObject>::value )
+			{
+				return countIds( 1U, static_cast<QueryComponents_t<QueryObject>*>(nullptr) ) != 0U;
+			}
+			else
+			{
+				bool result = false;
+				eachCandidate( [&]( const Entity& entity )
+				{
+					result = queryObject(entity);
+					return !result;
+				}, static_cast<QueryComponents_t<QueryObject>*>(nullptr) );
+				return result;
+			}
+		}
+
 	private:
 
+		/** Count entities having all of Components by intersecting the collection ids, stopping once @p limit is reached */
+		template<typename... Components>
+		std::size_t countIds( std::size_t limit, std::tuple<Components...>* )
+		{
+			const std::tuple< const Collection<Components>*... > collections( CollectionRegistry::find<Components>()... );
+			bool missing = false;
+			std::apply( [&]( const auto*... collection ) { missing = ((collection == nullptr) || ...); }, collections );
+			if ( missing )
+				return 0U; //< No entity can have an unregistered component
+
+			if constexpr ( sizeof...(Components) == 1U )
+			{
+				return std::min( std::get<0>(collections)->size(), limit );
+			}
+			else
+			{
+				return countIntersection( limit, collections, std::index_sequence_for<Components...>{} );
+			}
+		}
+
+		template<typename Collections, std::size_t... Is>
+		static std::size_t countIntersection( std::size_t limit, const Collections& collections, std::index_sequence<Is...> indices )
+		{
+			const EntityId* const ids[] = { std::get<Is>(collections)->ids().data()... };
+			auto iterators = std::make_tuple( ids[Is]... );
+			const auto endIterators = std::make_tuple( (ids[Is] + std::get<Is>(collections)->size())... );
+
+			std::size_t result = 0U;
+			if ( Intersection::beginN( indices, iterators, endIterators ) )
+			{
+				do
+				{
+					if ( ++result == limit )
+						break;
+				}
+				while ( Intersection::incrementN( indices, iterators, endIterators ) );
+			}
+			return result;
+		}
+
+		/** Invoke func(Entity) for entities that may match a query requiring Components until func returns false
+		 * Candidates are the ids of the smallest required collection, or every created entity if none are required
+		 */
+		template<typename Func, typename... Components>
+		void eachCandidate( Func&& func, std::tuple<Components...>* )
+		{
+			if constexpr ( sizeof...(Components) == 0U )
+			{
+				if ( isNull(lastEntityId_) )
+					return; //< No entities created
+				for ( std::uint32_t id = 0U; id <= lastEntityId_.value; ++id )
+				{
+					if ( !func( Entity( *this, EntityId{id} ) ) )
+						return;
+				}
+			}
+			else
+			{
+				std::span<const EntityId> candidates; //< Ids of any IdContainer, @see ComponentStorage
+				bool chosen = false;
+				bool missing = false;
+				([&]()
+				{
+					const Collection<Components>* collection = CollectionRegistry::find<Components>();
+					if ( collection == nullptr )
+						missing = true;
+					else if ( !chosen || collection->size() < candidates.size() )
+					{
+						candidates = std::span<const EntityId>( collection->ids().data(), collection->size() );
+						chosen = true;
+					}
+				}(), ...);
+				if ( missing )
+					return; //< No entity can have an unregistered component
+
+				for ( EntityId entityId : candidates )
+				{
+					if ( !func( Entity( *this, entityId ) ) )
+						return;
+				}
+			}
+		}
+
 		EntityId newEntityId()
 		{ return lastEntityId_ = lastEntityId_.next(); }
 
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility> //< std::forward
+#include <vector>
+
+#include "StaticWorld.hpp"
+#include "System.hpp"
+#include "Utility/ThreadPool.hpp"
+
+namespace SubzeroECS
+{
+	/** Many small worlds stepped in parallel by the same systems
+	 *
+	 * Each world is a StaticWorld, so shards carry no CollectionRegistry tables or registry id
+	 * (which also limits a process to CollectionRegistry::Capacity Worlds). Systems are constructed once per
+	 * world when added, so update() neither builds Views nor looks up collections per step.
+	 * Worlds are split over the thread pool in contiguous ranges by index, so each world is always
+	 * stepped by the same thread and stays in that core's cache between steps.
+	 *
+	 * @tparam Components  All component types that entities of the worlds may have
+	 */
+	template< typename... Components >
+	class WorldGroup
+	{
+	public:
+		using WorldType = StaticWorld<Components...>;
+
+		/** @param threadCount  Threads stepping the worlds including the caller, 0 selects the hardware concurrency */
+		explicit WorldGroup( std::size_t threadCount = 0U )
+		: threadPool_(threadCount)
+		{}
+
+		/** Create a new world with an instance of every system added so far */
+		WorldType& createWorld()
+		{
+			std::unique_ptr<Shard>& shard = shards_.emplace_back( std::make_unique<Shard>() );
+			for ( const SystemFactory& factory : systemFactories_ )
+			{
+				shard->systems.push_back( factory( shard->world ) );
+			}
+			return shard->world;
+		}
+
+		/** Add a system that is constructed as SystemType(world, args...) for every current and future world
+		 * @remark Systems are updated in the order they were added
+		 */
+		template< typename SystemType, typename... Args >
+		void addSystem( Args&&... args )
+		{
+			SystemFactory& factory = systemFactories_.emplace_back(
+				[...args = std::forward<Args>(args)]( WorldType& world ) -> std::unique_ptr<ISystem>
+				{
+					return std::make_unique<SystemType>( world, args... );
+				});
+
+			for ( std::unique_ptr<Shard>& shard : shards_ )
+			{
+				shard->systems.push_back( factory( shard->world ) );
+			}
+		}
+
+		/** Step every world through all systems in parallel */
+		void update()
+		{
+			threadPool_.forEachIndex( shards_.size(), [this]( std::size_t index )
+			{
+				for ( std::unique_ptr<ISystem>& system : shards_[index]->systems )
+				{
+					system->update();
+				}
+			});
+		}
+
+		/** Call func(world, index) for every world in parallel with the same thread affinity as update() */
+		template< typename Func >
+		void forEachWorld( Func&& func )
+		{
+			threadPool_.forEachIndex( shards_.size(), [this, &func]( std::size_t index )
+			{
+				func( shards_[index]->world, index );
+			});
+		}
+
+		WorldType& world( std::size_t index ) noexcept
+		{ return shards_[index]->world; }
+
+		/// Number of worlds
+		std::size_t size() const noexcept
+		{ return shards_.size(); }
+
+		/// Number of threads stepping the worlds
+		std::size_t threadCount() const noexcept
+		{ return threadPool_.size(); }
+
+	private:
+		using SystemFactory = std::function< std::unique_ptr<ISystem>( WorldType& ) >;
+
+		/** A world and its system instances, heap allocated so the world address is stable for its Views */
+		struct Shard
+		{
+			WorldType world; ///< Entities of the shard
+			std::vector< std::unique_ptr<ISystem> > systems; ///< System instances bound to world
+		};
+
+	private:
+		std::vector< std::unique_ptr<Shard> > shards_; //< Worlds in stepping order
+		std::vector< SystemFactory > systemFactories_; //< Constructors of the added systems
+		Utility::ThreadPool threadPool_; //< Threads stepping the worlds
+	};
+
+} //END: SubzeroECS
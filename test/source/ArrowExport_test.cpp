@@ -0,0 +1,149 @@
+#include "SubzeroECS/ArrowExport.hpp"
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/World.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace SubzeroECS {
+namespace Test {
+
+	struct Point
+	{
+		float x;
+		float y;
+	};
+
+} //END: Test
+
+	template<>
+	struct ArrowFields<Test::Point>
+	{
+		static constexpr const char* name = "point";
+		static constexpr auto members = std::make_tuple( ArrowField{ "x", &Test::Point::x }, ArrowField{ "y", &Test::Point::y } );
+	};
+
+	template<>
+	struct ArrowFields<Health>
+	{
+		static constexpr const char* name = "health";
+	};
+
+namespace Test {
+
+	template< typename T >
+	const T* arrowValues( const ArrowArray& array )
+	{ return static_cast<const T*>( array.buffers[1] ); }
+
+	TEST(ArrowExport, CollectionZeroCopy)
+	{
+		CollectionRegistry registry;
+		Collection<Age> ageCollection(registry);
+		for ( auto id : { 2U, 5U, 9U } ) ageCollection.create( EntityId{id}, Age{id * 10U} );
+
+		ArrowArray array;
+		ArrowSchema schema;
+		exportArrow( ageCollection, &array, &schema );
+
+		ASSERT_EQ( std::string(schema.format), "+s" );
+		ASSERT_EQ( schema.n_children, 2 );
+		ASSERT_EQ( std::string(schema.children[0]->format), "I" );
+		ASSERT_EQ( std::string(schema.children[0]->name), "id" );
+		ASSERT_EQ( std::string(schema.children[1]->format), "w:4" ); //< Trivially copyable struct without members
+		ASSERT_EQ( std::string(schema.children[1]->name), "component0" );
+
+		ASSERT_EQ( array.length, 3 );
+		ASSERT_EQ( array.n_buffers, 1 );
+		ASSERT_EQ( array.n_children, 2 );
+		ASSERT_EQ( array.children[0]->n_buffers, 2 );
+		ASSERT_EQ( array.children[0]->buffers[0], nullptr );
+		ASSERT_EQ( array.children[0]->buffers[1], static_cast<const void*>( ageCollection.ids().data() ) );
+		ASSERT_EQ( array.children[1]->buffers[1], static_cast<const void*>( ageCollection.components().data() ) );
+		ASSERT_EQ( arrowValues<uint32_t>( *array.children[0] )[2], 9U );
+		ASSERT_EQ( arrowValues<uint32_t>( *array.children[1] )[1], 50U );
+
+		array.release( &array );
+		schema.release( &schema );
+		ASSERT_EQ( array.release, nullptr );
+		ASSERT_EQ( schema.release, nullptr );
+	}
+
+	TEST(ArrowExport, StructMembers)
+	{
+		CollectionRegistry registry;
+		Collection<Point> pointCollection(registry);
+		pointCollection.create( EntityId{1U}, Point{1.0F, 2.0F} );
+		pointCollection.create( EntityId{4U}, Point{3.0F, 4.0F} );
+
+		ArrowArray array;
+		ArrowSchema schema;
+		exportArrow( pointCollection, &array, &schema );
+
+		const ArrowSchema& point = *schema.children[1];
+		ASSERT_EQ( std::string(point.format), "+s" );
+		ASSERT_EQ( std::string(point.name), "point" );
+		ASSERT_EQ( point.n_children, 2 );
+		ASSERT_EQ( std::string(point.children[0]->name), "x" );
+		ASSERT_EQ( std::string(point.children[0]->format), "f" );
+		ASSERT_EQ( std::string(point.children[1]->name), "y" );
+
+		const ArrowArray& points = *array.children[1];
+		ASSERT_EQ( points.n_children, 2 );
+		ASSERT_EQ( arrowValues<float>( *points.children[0] )[1], 3.0F );
+		ASSERT_EQ( arrowValues<float>( *points.children[1] )[0], 2.0F );
+		ASSERT_EQ( arrowValues<float>( *points.children[1] )[1], 4.0F );
+
+		// Consumers may move a child out and release it independently
+		ArrowArray ids = *array.children[0];
+		array.children[0]->release = nullptr;
+		array.release( &array );
+		ASSERT_EQ( arrowValues<uint32_t>( ids )[1], 4U );
+		ids.release( &ids );
+		schema.release( &schema );
+	}
+
+	TEST(ArrowExport, ViewGathersRows)
+	{
+		World world;
+		Collection<Health, Shoes, Point> collections(world);
+		(void)world.create( Health{10.0F} );
+		const Entity both = world.create( Health{20.0F}, Shoes{7.0F}, Point{5.0F, 6.0F} );
+		(void)world.create( Shoes{8.0F} );
+
+		View<Health, Shoes> view(world);
+		ArrowArray array;
+		ArrowSchema schema;
+		exportArrow( view, &array, &schema );
+
+		ASSERT_EQ( array.length, 1 );
+		ASSERT_EQ( schema.n_children, 3 );
+		ASSERT_EQ( std::string(schema.children[1]->name), "health" );
+		ASSERT_EQ( std::string(schema.children[1]->format), "w:4" ); //< ArrowFields without members only names the column
+		ASSERT_EQ( std::string(schema.children[2]->name), "component1" );
+		ASSERT_EQ( arrowValues<uint32_t>( *array.children[0] )[0], both.id().value );
+		ASSERT_EQ( arrowValues<float>( *array.children[2] )[0], 7.0F );
+
+		array.release( &array );
+		schema.release( &schema );
+	}
+
+	TEST(ArrowExport, SingleComponentView)
+	{
+		World world;
+		Collection<Point> collections(world);
+		(void)world.create( Point{1.0F, 2.0F} );
+
+		View<Point> view(world);
+		ArrowArray array;
+		ArrowSchema schema;
+		exportArrow( view, &array, &schema );
+		ASSERT_EQ( array.length, 1 );
+		ASSERT_EQ( array.children[0]->buffers[1], static_cast<const void*>( world.CollectionRegistry::get<Point>().ids().data() ) );
+		array.release( &array );
+		schema.release( &schema );
+	}
+
+} //END: Test
+} //END: SubzeroECS
@@ -0,0 +1,86 @@
+#include "SubzeroECS/World.hpp"
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/BucketedSystem.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace SubzeroECS {
+namespace Test {
+
+	using Bucket0 = UpdateBucket<0>;
+	using Bucket1 = UpdateBucket<1>;
+	using Bucket2 = UpdateBucket<2>;
+
+	/** Counts updates of each entity in its Age */
+	class AgeBucketSystem : public BucketedSystem<AgeBucketSystem, 3U, Age>
+	{
+	public:
+		AgeBucketSystem(World& world) : BucketedSystem<AgeBucketSystem, 3U, Age>(world) {}
+
+		void processEntity(Age& age)
+		{
+			++age.age;
+		}
+	};
+
+	TEST(BucketedSystem, IsDue_Staggered)
+	{
+		for ( std::uint64_t frame = 0U; frame != 64U; ++frame )
+		{
+			ASSERT_TRUE( AgeBucketSystem::isDue( 0U, frame ) );
+			std::size_t due = 0U;
+			for ( std::size_t level = 1U; level != 6U; ++level ) due += AgeBucketSystem::isDue( level, frame ) ? 1U : 0U;
+			ASSERT_LE( due, 1U ) << "frame " << frame;
+		}
+		ASSERT_TRUE( AgeBucketSystem::isDue( 1U, 1U ) );
+		ASSERT_TRUE( AgeBucketSystem::isDue( 2U, 2U ) );
+		ASSERT_TRUE( AgeBucketSystem::isDue( 2U, 6U ) );
+		ASSERT_FALSE( AgeBucketSystem::isDue( 2U, 4U ) );
+	}
+
+	TEST(BucketedSystem, UpdateRates)
+	{
+		World world;
+		Collection<Age, Bucket0, Bucket1, Bucket2> collections(world);
+		Entity everyFrame = world.create( Age{0U}, Bucket0{} );
+		Entity everySecond = world.create( Age{0U}, Bucket1{} );
+		Entity everyFourth = world.create( Age{0U}, Bucket2{} );
+		Entity untagged = world.create( Age{0U} );
+
+		AgeBucketSystem system(world);
+		for ( int frame = 0; frame != 8; ++frame ) system.updateBuckets();
+
+		EXPECT_EQ( everyFrame.get<Age>().age, 8U );
+		EXPECT_EQ( everySecond.get<Age>().age, 4U );
+		EXPECT_EQ( everyFourth.get<Age>().age, 2U );
+		EXPECT_EQ( untagged.get<Age>().age, 0U );
+
+		// Promote to every frame by moving bucket
+		ASSERT_TRUE( world.remove<Bucket2>( everyFourth.id() ) );
+		world.add( everyFourth.id(), Bucket0{} );
+		system.updateBuckets();
+		EXPECT_EQ( everyFourth.get<Age>().age, 3U );
+	}
+
+	TEST(BucketedSystem, UpdateThroughISystem)
+	{
+		World world;
+		Collection<Age, Bucket0, Bucket1, Bucket2> collections(world);
+		Entity everyFrame = world.create( Age{0U}, Bucket0{} );
+		Entity everyFourth = world.create( Age{0U}, Bucket2{} );
+		Entity untagged = world.create( Age{0U} );
+
+		AgeBucketSystem system(world);
+		ISystem& base = system;
+		for ( int frame = 0; frame != 8; ++frame ) base.update();
+
+		EXPECT_EQ( everyFrame.get<Age>().age, 8U );
+		EXPECT_EQ( everyFourth.get<Age>().age, 2U );
+		EXPECT_EQ( untagged.get<Age>().age, 0U );
+	}
+
+} //END: Test
+} //END: SubzeroECS
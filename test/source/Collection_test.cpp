@@ -4,7 +4,22 @@
 #include "TestTypes.hpp"
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <vector>
+
 namespace SubzeroECS {
+	namespace Test
+	{
+		/** Heavy component whose members own heap memory but are trivially relocatable */
+		struct Inventory
+		{
+			std::vector<uint32_t> items;
+			std::unique_ptr<uint32_t> equipped;
+		};
+	}
+
+	template<> struct ComponentRelocatable<Test::Inventory> : std::true_type {};
+
 	namespace Test 
 	{
 
@@ -15,6 +30,176 @@ namespace SubzeroECS {
 			ASSERT_NE( nullptr, humanCollection.create( EntityId{0U}, Human() ) );
 		}
 
+		TEST(Collection,Remove)
+		{
+			CollectionRegistry collectionRegistry;
+			Collection<Age> ageCollection(collectionRegistry);
+			for ( auto id : { 1U, 2U, 3U } ) ageCollection.create( EntityId{id}, Age{id} );
+			const auto version = ageCollection.version();
+
+			ASSERT_TRUE( ageCollection.remove( EntityId{2U} ) );
+			ASSERT_FALSE( ageCollection.remove( EntityId{2U} ) );
+			ASSERT_FALSE( ageCollection.remove( EntityId{7U} ) );
+			ASSERT_EQ( ageCollection.size(), 2U );
+			ASSERT_FALSE( ageCollection.has( EntityId{2U} ) );
+			ASSERT_EQ( ageCollection.find( EntityId{3U} )->age, 3U );
+			ASSERT_NE( ageCollection.version(), version );
+		}
+
+		TEST(Collection,Relocatable)
+		{
+			static_assert( Collection<Age>::IsRelocatable );
+			static_assert( Collection<Inventory>::IsRelocatable );
+
+			CollectionRegistry collectionRegistry;
+			Collection<Inventory> inventories(collectionRegistry);
+			for ( uint32_t id = 20U; id > 0U; id -= 2U )
+				inventories.create( EntityId{id}, Inventory{ std::vector<uint32_t>( id, id ), std::make_unique<uint32_t>(id) } );
+			inventories.create( EntityId{7U}, Inventory{ { 7U }, std::make_unique<uint32_t>(7U) } );
+			ASSERT_TRUE( inventories.remove( EntityId{2U} ) );
+			ASSERT_TRUE( inventories.remove( EntityId{12U} ) );
+			ASSERT_EQ( inventories.size(), 9U );
+
+			for ( size_t i = 0U; i < inventories.size(); ++i )
+			{
+				const uint32_t id = inventories.ids()[i].value;
+				const Inventory& inventory = inventories.components()[i];
+				ASSERT_EQ( *inventory.equipped, id );
+				ASSERT_EQ( inventory.items.back(), id );
+			}
+		}
+
+		TEST(Collection,Clear)
+		{
+			CollectionRegistry collectionRegistry;
+			Collection<Age, Health> collections(collectionRegistry);
+			for ( uint32_t id = 0U; id < 50U; ++id )
+			{
+				collections.get<Age>().create( EntityId{id}, Age{id} );
+				collections.get<Health>().create( EntityId{id}, Health{ float(id) } );
+			}
+			ASSERT_EQ( collections.group().sync().size(), 50U );
+			const auto version = collections.get<Age>().version();
+			const size_t capacity = collections.get<Age>().components().capacity();
+
+			collections.clear();
+			ASSERT_EQ( collections.get<Age>().size(), 0U );
+			ASSERT_EQ( collections.get<Health>().size(), 0U );
+			ASSERT_NE( collections.get<Age>().version(), version );
+			ASSERT_EQ( collections.get<Age>().components().capacity(), capacity );
+			ASSERT_EQ( collections.group().sync().size(), 0U );
+			ASSERT_EQ( collections.get<Age>().find( EntityId{3U} ), nullptr );
+		}
+
+		TEST(Collection,RemoveMany)
+		{
+			CollectionRegistry collectionRegistry;
+			Collection<Age> ageCollection(collectionRegistry);
+			for ( uint32_t id = 0U; id < 10U; ++id ) ageCollection.create( EntityId{id}, Age{id * 10U} );
+			const auto version = ageCollection.version();
+
+			ASSERT_EQ( ageCollection.removeMany( std::span<const EntityId>{} ), 0U );
+			ASSERT_EQ( ageCollection.version(), version );
+
+			const EntityId entityIds[] = { EntityId{0U}, EntityId{3U}, EntityId{4U}, EntityId{4U}, EntityId{8U}, EntityId{12U} };
+			ASSERT_EQ( ageCollection.removeMany( entityIds ), 4U );
+			ASSERT_NE( ageCollection.version(), version );
+
+			const std::vector<EntityId> expected = { EntityId{1U}, EntityId{2U}, EntityId{5U}, EntityId{6U}, EntityId{7U}, EntityId{9U} };
+			ASSERT_EQ( ageCollection.ids(), expected );
+			for ( size_t i = 0U; i < expected.size(); ++i )
+				ASSERT_EQ( ageCollection.components()[i].age, expected[i].value * 10U );
+		}
+
+		TEST(Collection,CreateMany)
+		{
+			CollectionRegistry collectionRegistry;
+			Collection<Age> ageCollection(collectionRegistry);
+			for ( uint32_t id : { 2U, 5U } ) ageCollection.create( EntityId{id}, Age{id * 10U} );
+
+			// Appended above the existing ids
+			const EntityId appendIds[] = { EntityId{6U}, EntityId{9U} };
+			Age appendAges[] = { Age{60U}, Age{90U} };
+			ageCollection.createMany( appendIds, appendAges );
+
+			// Merged between the existing ids
+			const auto version = ageCollection.version();
+			const EntityId mergeIds[] = { EntityId{0U}, EntityId{3U}, EntityId{7U}, EntityId{12U} };
+			Age mergeAges[] = { Age{0U}, Age{30U}, Age{70U}, Age{120U} };
+			ageCollection.createMany( mergeIds, mergeAges );
+			ASSERT_NE( ageCollection.version(), version );
+
+			const std::vector<EntityId> expected = { EntityId{0U}, EntityId{2U}, EntityId{3U}, EntityId{5U}, EntityId{6U}, EntityId{7U}, EntityId{9U}, EntityId{12U} };
+			ASSERT_EQ( ageCollection.ids(), expected );
+			for ( size_t i = 0U; i < expected.size(); ++i )
+				ASSERT_EQ( ageCollection.components()[i].age, expected[i].value * 10U );
+		}
+
+		TEST(Collection,CreateMany_Duplicate)
+		{
+			CollectionRegistry collectionRegistry;
+			Collection<Age> ageCollection(collectionRegistry);
+			for ( uint32_t id : { 2U, 5U } ) ageCollection.create( EntityId{id}, Age{id} );
+
+			const EntityId entityIds[] = { EntityId{1U}, EntityId{5U} };
+			Age ages[] = { Age{1U}, Age{5U} };
+			ASSERT_THROW( ageCollection.createMany( entityIds, ages ), std::invalid_argument );
+
+			const std::vector<EntityId> expected = { EntityId{2U}, EntityId{5U} };
+			ASSERT_EQ( ageCollection.ids(), expected );
+		}
+
+		TEST(Collection,CreateRange)
+		{
+			CollectionRegistry collectionRegistry;
+			Collection<Age> ageCollection(collectionRegistry);
+			ageCollection.create( EntityId{4U}, Age{4U} );
+
+			ASSERT_EQ( ageCollection.createRange( EntityRange{ EntityId{10U}, 5U }, Age{7U} ), 1U );
+			ASSERT_EQ( ageCollection.size(), 6U );
+			ASSERT_EQ( ageCollection.ids().back(), EntityId{14U} );
+			ASSERT_EQ( ageCollection.get( EntityId{12U} ).age, 7U );
+
+			ASSERT_EQ( ageCollection.createRange( EntityRange{ EntityId{20U}, 0U }, Age{0U} ), 6U );
+			ASSERT_THROW( ageCollection.createRange( EntityRange{ EntityId{14U}, 2U }, Age{0U} ), std::invalid_argument );
+			ASSERT_EQ( ageCollection.size(), 6U );
+		}
+
+		TEST(Collection,FindMany_Sorted)
+		{
+			CollectionRegistry collectionRegistry;
+			Collection<Age> ageCollection(collectionRegistry);
+			for ( auto id : { 1U, 2U, 3U, 5U, 8U, 13U, 21U, 34U } ) ageCollection.create( EntityId{id}, Age{id} );
+
+			const EntityId entityIds[] = { EntityId{1U}, EntityId{4U}, EntityId{5U}, EntityId{5U}, EntityId{34U}, EntityId{40U} };
+			Age* ages[std::size(entityIds)] = {};
+			ageCollection.findMany( entityIds, ages );
+
+			EXPECT_EQ( ages[0], ageCollection.find( EntityId{1U} ) );
+			EXPECT_EQ( ages[1], nullptr );
+			EXPECT_EQ( ages[2]->age, 5U );
+			EXPECT_EQ( ages[3], ages[2] );
+			EXPECT_EQ( ages[4]->age, 34U );
+			EXPECT_EQ( ages[5], nullptr );
+		}
+
+		TEST(Collection,FindMany_Unsorted)
+		{
+			CollectionRegistry collectionRegistry;
+			Collection<Age> ageCollection(collectionRegistry);
+			for ( uint32_t id = 1U; id <= 1000U; id += 3U ) ageCollection.create( EntityId{id}, Age{id} );
+
+			std::vector<EntityId> entityIds;
+			for ( uint32_t i = 0U; i != 500U; ++i ) entityIds.push_back( EntityId{ (i * 7919U) % 1200U } );
+			std::vector<Age*> ages( entityIds.size() );
+			ageCollection.findMany( entityIds, ages );
+
+			for ( size_t i = 0U; i != entityIds.size(); ++i )
+			{
+				EXPECT_EQ( ages[i], ageCollection.find( entityIds[i] ) );
+			}
+		}
+
 
 	} //END: Test
 } //END: SubzeroECS
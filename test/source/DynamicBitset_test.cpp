@@ -0,0 +1,58 @@
+#include "SubzeroECS/Utility/DynamicBitset.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace SubzeroECS {
+	namespace Test
+	{
+		using Utility::DynamicBitset;
+
+		TEST(DynamicBitset, Empty)
+		{
+			DynamicBitset bits;
+			ASSERT_EQ( bits.wordCount(), 0U );
+			ASSERT_FALSE( bits.test( 0U ) );
+			ASSERT_FALSE( bits.test( 1000U ) );
+			bits.reset( 1000U ); //< Out of range reset is a no-op
+			ASSERT_EQ( bits.count(), 0U );
+		}
+
+		TEST(DynamicBitset, SetGrowsWholeBlocks)
+		{
+			DynamicBitset bits;
+			bits.set( 3U );
+			ASSERT_EQ( bits.wordCount(), DynamicBitset::BlockWords );
+			bits.set( 256U );
+			ASSERT_EQ( bits.wordCount(), 2U * DynamicBitset::BlockWords );
+
+			ASSERT_TRUE( bits.test( 3U ) );
+			ASSERT_TRUE( bits.test( 256U ) );
+			ASSERT_FALSE( bits.test( 4U ) );
+			ASSERT_EQ( bits.count(), 2U );
+
+			bits.reset( 3U );
+			ASSERT_FALSE( bits.test( 3U ) );
+			ASSERT_EQ( bits.count(), 1U );
+		}
+
+		TEST(DynamicBitset, ClearRetainsWords)
+		{
+			DynamicBitset bits;
+			bits.set( 700U );
+			const auto wordCount = bits.wordCount();
+			bits.clear();
+			ASSERT_EQ( bits.wordCount(), wordCount );
+			ASSERT_EQ( bits.count(), 0U );
+		}
+
+		TEST(DynamicBitset, ForEachSetBit)
+		{
+			std::vector<std::size_t> indices;
+			Utility::forEachSetBit( 0x8000000000000005ULL, 128U, [&]( std::size_t index ) { indices.push_back( index ); } );
+			ASSERT_EQ( indices, (std::vector<std::size_t>{ 128U, 130U, 191U }) );
+		}
+
+	} //END: Test
+} //END: SubzeroECS
@@ -0,0 +1,189 @@
+#include "SubzeroECS/DynamicCollection.hpp"
+#include "SubzeroECS/DynamicView.hpp"
+#include "SubzeroECS/StaticWorld.hpp"
+#include "SubzeroECS/World.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace SubzeroECS {
+namespace Test {
+
+	/** Native mirror of a script-defined component */
+	struct alignas(16) ScriptVelocity
+	{
+		float x;
+		float y;
+		double scale;
+	};
+
+	static ComponentLayout velocityLayout()
+	{
+		return ComponentLayout::of<ScriptVelocity>( "Velocity", {
+			ComponentField{ "x", offsetof(ScriptVelocity, x), sizeof(float), FieldType::Float32 },
+			ComponentField{ "y", offsetof(ScriptVelocity, y), sizeof(float), FieldType::Float32 },
+			ComponentField{ "scale", offsetof(ScriptVelocity, scale), sizeof(double), FieldType::Float64 } } );
+	}
+
+	TEST(DynamicCollection, Layout)
+	{
+		const ComponentLayout layout = velocityLayout();
+		ASSERT_EQ( layout.size, sizeof(ScriptVelocity) );
+		ASSERT_EQ( layout.alignment, 16U );
+		ASSERT_EQ( layout.findField( "scale" )->offset, offsetof(ScriptVelocity, scale) );
+		ASSERT_EQ( layout.findField( "z" ), nullptr );
+
+		EXPECT_THROW( DynamicCollection( 0U, ComponentLayout{ "Odd", 12U, 8U, {} } ), std::invalid_argument );
+		EXPECT_THROW( DynamicCollection( 0U, ComponentLayout{ "Zero", 4U, 0U, {} } ), std::invalid_argument );
+		EXPECT_THROW( DynamicCollection( 0U, ComponentLayout{ "Field", 4U, 4U, { ComponentField{ "f", 2U, 4U, FieldType::Unknown } } } ), std::invalid_argument );
+		EXPECT_THROW( DynamicCollection( 0U, ComponentLayout{ "Typed", 8U, 8U, { ComponentField{ "f", 0U, 4U, FieldType::Float64 } } } ), std::invalid_argument );
+	}
+
+	TEST(DynamicCollection, CreateRemove)
+	{
+		DynamicCollection collection( 3U, velocityLayout() );
+		ASSERT_EQ( collection.componentId(), 3U );
+
+		// Enough out of order inserts to grow and shift the column several times
+		for ( std::uint32_t i = 0U; i < 100U; ++i )
+		{
+			const std::uint32_t id = (i * 37U) % 100U;
+			const ScriptVelocity velocity{ float(id), -float(id), double(id) * 0.5 };
+			std::byte* bytes = collection.create( EntityId{id}, &velocity );
+			ASSERT_EQ( reinterpret_cast<std::uintptr_t>(bytes) % 16U, 0U );
+		}
+		ASSERT_EQ( collection.size(), 100U );
+		ASSERT_THROW( collection.create( EntityId{5U} ), std::invalid_argument );
+		ASSERT_TRUE( std::is_sorted( collection.ids().begin(), collection.ids().end() ) );
+
+		for ( std::size_t i = 0U; i < collection.size(); ++i )
+		{
+			const ScriptVelocity& velocity = collection.as<ScriptVelocity>( i );
+			ASSERT_EQ( velocity.x, float(collection.ids()[i].value) );
+			ASSERT_EQ( velocity.scale, double(collection.ids()[i].value) * 0.5 );
+		}
+
+		const auto version = collection.version();
+		ASSERT_TRUE( collection.remove( EntityId{50U} ) );
+		ASSERT_FALSE( collection.remove( EntityId{50U} ) );
+		ASSERT_NE( collection.version(), version );
+		ASSERT_EQ( collection.find( EntityId{50U} ), nullptr );
+		ASSERT_THROW( collection.get( EntityId{50U} ), std::invalid_argument );
+
+		const EntityId removed[] = { EntityId{0U}, EntityId{1U}, EntityId{50U}, EntityId{98U}, EntityId{200U} };
+		ASSERT_EQ( collection.removeMany( removed ), 3U );
+		ASSERT_EQ( collection.size(), 96U );
+		ScriptVelocity velocity;
+		std::memcpy( &velocity, collection.get( EntityId{99U} ), sizeof(velocity) );
+		ASSERT_EQ( velocity.y, -99.0F );
+		std::memcpy( &velocity, collection.get( EntityId{2U} ), sizeof(velocity) );
+		ASSERT_EQ( velocity.x, 2.0F );
+	}
+
+	TEST(DynamicCollection, TagAndZeroFill)
+	{
+		DynamicCollection tags( 0U, ComponentLayout{ "Enemy", 0U, 1U, {} } );
+		ASSERT_NE( tags.create( EntityId{4U} ), nullptr );
+		ASSERT_NE( tags.find( EntityId{4U} ), nullptr );
+		ASSERT_TRUE( tags.has( EntityId{4U} ) );
+		ASSERT_FALSE( tags.has( EntityId{3U} ) );
+
+		DynamicCollection counters( 1U, ComponentLayout{ "Counter", 8U, 8U, {} } );
+		const std::byte* counter = counters.create( EntityId{1U} );
+		ASSERT_TRUE( std::all_of( counter, counter + 8, []( std::byte b ) { return b == std::byte{0}; } ) );
+	}
+
+	TEST(DynamicCollection, Registry)
+	{
+		DynamicComponentRegistry registry;
+		const DynamicComponentId velocity = registry.registerComponent( velocityLayout() );
+		const DynamicComponentId enemy = registry.registerComponent( ComponentLayout{ "Enemy", 0U, 1U, {} } );
+		ASSERT_NE( velocity, enemy );
+		ASSERT_EQ( registry.size(), 2U );
+		ASSERT_THROW( registry.registerComponent( ComponentLayout{ "Enemy", 0U, 1U, {} } ), std::invalid_argument );
+		ASSERT_EQ( registry.find( "Velocity" ), &registry.get( velocity ) );
+		ASSERT_EQ( registry.find( "Missing" ), nullptr );
+		ASSERT_EQ( registry.find( DynamicComponentId{7U} ), nullptr );
+		ASSERT_THROW( registry.get( DynamicComponentId{7U} ), std::invalid_argument );
+
+		registry.get( velocity ).create( EntityId{1U} );
+		registry.get( enemy ).create( EntityId{1U} );
+		ASSERT_EQ( registry.remove( EntityId{1U} ), 2U );
+		ASSERT_EQ( registry.remove( EntityId{1U} ), 0U );
+	}
+
+	TEST(DynamicView, IntersectsStaticAndDynamic)
+	{
+		World world;
+		Collection<Age, Health> collections( world );
+		DynamicComponentRegistry registry;
+		const DynamicComponentId velocity = registry.registerComponent( velocityLayout() );
+		const DynamicComponentId enemy = registry.registerComponent( ComponentLayout{ "Enemy", 0U, 1U, {} } );
+
+		for ( std::uint32_t i = 0U; i < 30U; ++i )
+		{
+			const Entity entity = world.create( Age{i} );
+			if ( i % 2U == 0U )
+				world.add( entity.id(), Health{ float(i) } );
+			if ( i % 3U == 0U )
+			{
+				const ScriptVelocity value{ float(i), 0.0F, 2.0 };
+				registry.get( velocity ).create( entity.id(), &value );
+			}
+			if ( i % 5U == 0U )
+				registry.get( enemy ).create( entity.id() );
+		}
+
+		const DynamicComponentId ids[] = { velocity };
+		DynamicView<Age, Health> view( world, registry, ids );
+		ASSERT_EQ( view.count(), 5U ); //< Multiples of 6 below 30
+		ASSERT_EQ( view.dynamicCount(), 1U );
+
+		const std::uint32_t scaleOffset = registry.get( velocity ).layout().findField( "scale" )->offset;
+		std::vector<EntityId> visited;
+		view.each( [&]( const DynamicRow& row, Age& age, Health& health )
+		{
+			ASSERT_EQ( age.age % 6U, 0U );
+			ASSERT_EQ( health.percent, float(age.age) );
+			ASSERT_EQ( row.field<float>( 0U, 0U ), float(age.age) );
+			row.field<double>( 0U, scaleOffset ) *= 2.0;
+			visited.push_back( row.id() );
+		});
+		ASSERT_EQ( visited.size(), 5U );
+		ASSERT_EQ( registry.get( velocity ).as<ScriptVelocity>( 2U ).scale, 4.0 ); //< Entity 6
+		ASSERT_EQ( registry.get( velocity ).as<ScriptVelocity>( 1U ).scale, 2.0 ); //< Entity 3 has no Health
+
+		// Dynamic components only, multiples of 15
+		const DynamicComponentId both[] = { velocity, enemy };
+		DynamicView<> dynamicOnly( world, registry, both );
+		ASSERT_EQ( dynamicOnly.count(), 2U );
+
+		const DynamicComponentId missing[] = { DynamicComponentId{9U} };
+		ASSERT_THROW( (DynamicView<Age>( world, registry, missing )), std::invalid_argument );
+	}
+
+	TEST(DynamicView, StaticWorld)
+	{
+		StaticWorld<Age> world;
+		DynamicComponentRegistry registry;
+		const DynamicComponentId tag = registry.registerComponent( ComponentLayout{ "Tag", 0U, 1U, {} } );
+		for ( std::uint32_t i = 0U; i < 10U; ++i )
+		{
+			const EntityId entityId = world.create( Age{i} );
+			if ( i >= 7U )
+				registry.get( tag ).create( entityId );
+		}
+
+		const DynamicComponentId ids[] = { tag };
+		DynamicView<Age> view( world, registry, ids );
+		std::uint32_t total = 0U;
+		view.each( [&]( const DynamicRow&, Age& age ) { total += age.age; } );
+		ASSERT_EQ( total, 7U + 8U + 9U );
+	}
+
+} //END: Test
+} //END: SubzeroECS
@@ -0,0 +1,79 @@
+#include "SubzeroECS/World.hpp"
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/Filter.hpp"
+#include "SubzeroECS/Logical.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace SubzeroECS {
+	namespace Test
+	{
+		/** Components with membership bitsets enabled */
+		struct Alive { };
+		struct Armed { };
+		struct Frozen { };
+	}
+
+	template<> struct ComponentMembership<Test::Alive> : std::true_type {};
+	template<> struct ComponentMembership<Test::Armed> : std::true_type {};
+	template<> struct ComponentMembership<Test::Frozen> : std::true_type {};
+
+	namespace Test
+	{
+		TEST(Filter, MembershipHas)
+		{
+			World world;
+			Collection<Alive> aliveCollection(world);
+			Entity entity = world.create( Alive{} );
+			Entity entityB = world.create();
+
+			ASSERT_TRUE( aliveCollection.has( entity.id() ) );
+			ASSERT_FALSE( aliveCollection.has( entityB.id() ) );
+			ASSERT_NE( world.find<Alive>( entity.id() ), nullptr );
+			ASSERT_EQ( world.find<Alive>( entityB.id() ), nullptr );
+			ASSERT_TRUE( entity % Has<Alive>() );
+			ASSERT_FALSE( entityB % Has<Alive>() );
+			ASSERT_EQ( aliveCollection.membership().count(), 1U );
+
+			ASSERT_TRUE( world.remove<Alive>( entity.id() ) );
+			ASSERT_FALSE( aliveCollection.has( entity.id() ) );
+			ASSERT_EQ( aliveCollection.membership().count(), 0U );
+		}
+
+		TEST(Filter, WithWithout)
+		{
+			World world;
+			Collection<Alive, Armed, Frozen> collections(world);
+
+			std::vector<EntityId> expected;
+			for ( uint32_t i = 0U; i != 1000U; ++i )
+			{
+				Entity entity = world.create( Alive{} );
+				if ( i % 3U == 0U ) world.add( entity.id(), Armed{} );
+				if ( i % 5U == 0U ) world.add( entity.id(), Frozen{} );
+				if ( i % 3U == 0U && i % 5U != 0U ) expected.push_back( entity.id() );
+			}
+
+			Filter< With<Alive, Armed>, Without<Frozen> > filter(world);
+			std::vector<EntityId> visited;
+			filter.each( [&]( EntityId entityId ) { visited.push_back( entityId ); } );
+			ASSERT_EQ( visited, expected );
+			ASSERT_EQ( filter.count(), expected.size() );
+		}
+
+		TEST(Filter, ExcludedShorterThanRequired)
+		{
+			World world;
+			Collection<Alive, Frozen> collections(world);
+			Entity frozen = world.create( Alive{}, Frozen{} );
+			for ( uint32_t i = 0U; i != 600U; ++i ) (void)world.create( Alive{} );
+
+			Filter< With<Alive>, Without<Frozen> > filter(world);
+			ASSERT_EQ( filter.count(), 600U );
+			filter.each( [&]( EntityId entityId ) { ASSERT_NE( entityId, frozen.id() ); } );
+		}
+
+	} //END: Test
+} //END: SubzeroECS
@@ -0,0 +1,123 @@
+#include "SubzeroECS/World.hpp"
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/FusedSystem.hpp"
+#include "SubzeroECS/StaticWorld.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace SubzeroECS {
+namespace Test {
+
+	struct FusedPosition { float x; };
+	struct FusedVelocity { float dx; };
+	struct FusedMass { float value; };
+
+	/** Accelerates by mass, processing entities through the View Iterator */
+	class FusedGravitySystem : public System<FusedGravitySystem, FusedVelocity, FusedMass>
+	{
+	public:
+		template< typename WorldType >
+		FusedGravitySystem(WorldType& world) : System<FusedGravitySystem, FusedVelocity, FusedMass>(world) {}
+
+		void processEntity(Iterator iEntity)
+		{
+			iEntity.get<FusedVelocity>().dx += iEntity.get<FusedMass>().value;
+		}
+	};
+
+	/** Integrates the velocity written by FusedGravitySystem, with components deduced from the signature */
+	class FusedMovementSystem : public System<FusedMovementSystem, FusedPosition, FusedVelocity>
+	{
+	public:
+		template< typename WorldType >
+		FusedMovementSystem(WorldType& world) : System<FusedMovementSystem, FusedPosition, FusedVelocity>(world) {}
+
+		void processEntity(EntityId entityId, FusedPosition& position, const FusedVelocity& velocity)
+		{
+			position.x += velocity.dx;
+			visited.push_back( entityId );
+		}
+
+		std::vector<EntityId> visited;
+	};
+
+	/** World of entities with all, or some, of the fused components */
+	struct FusedWorld
+	{
+		FusedWorld()
+			: collections( world )
+		{
+			for ( std::uint32_t i = 0U; i < 30U; ++i )
+			{
+				const Entity entity = world.create( FusedVelocity{ float(i) } );
+				if ( i % 3U != 0U )
+					world.add( entity.id(), FusedPosition{ 0.0F } );
+				if ( i % 5U != 0U )
+					world.add( entity.id(), FusedMass{ 1.0F } );
+			}
+		}
+
+		World world;
+		Collection<FusedPosition, FusedVelocity, FusedMass> collections;
+	};
+
+	TEST(FusedSystem, MatchesSequentialUpdates)
+	{
+		FusedWorld sequential;
+		FusedGravitySystem gravity( sequential.world );
+		FusedMovementSystem movement( sequential.world );
+
+		FusedWorld fused;
+		FusedGravitySystem fusedGravity( fused.world );
+		FusedMovementSystem fusedMovement( fused.world );
+		FusedSystem<FusedGravitySystem, FusedMovementSystem> system( fused.world, fusedGravity, fusedMovement );
+
+		for ( int frame = 0; frame < 3; ++frame )
+		{
+			gravity.update();
+			movement.update();
+			system.update();
+		}
+
+		// Multiples of 3 lack a position and of 5 a mass, the fused pass covers the rest
+		ASSERT_EQ( system.fusedCount(), 16U );
+		for ( std::uint32_t i = 0U; i < 30U; ++i )
+		{
+			const EntityId entityId{i};
+			ASSERT_EQ( fused.world.get<FusedVelocity>( entityId ).dx, sequential.world.get<FusedVelocity>( entityId ).dx );
+			if ( FusedPosition* position = fused.world.find<FusedPosition>( entityId ) )
+			{
+				ASSERT_EQ( position->x, sequential.world.get<FusedPosition>( entityId ).x );
+			}
+		}
+
+		// Each entity is processed once per update
+		std::vector<EntityId> visited = fusedMovement.visited;
+		std::sort( visited.begin(), visited.end() );
+		std::vector<EntityId> expected = movement.visited;
+		std::sort( expected.begin(), expected.end() );
+		ASSERT_EQ( visited, expected );
+	}
+
+	TEST(FusedSystem, StaticWorld)
+	{
+		StaticWorld<FusedPosition, FusedVelocity, FusedMass> world;
+		for ( std::uint32_t i = 0U; i < 10U; ++i )
+			world.create( FusedPosition{ 0.0F }, FusedVelocity{ 1.0F }, FusedMass{ float(i) } );
+
+		FusedGravitySystem gravity( world );
+		FusedMovementSystem movement( world );
+		FusedSystem<FusedGravitySystem, FusedMovementSystem> system( world, gravity, movement );
+		system.update();
+
+		ASSERT_EQ( system.fusedCount(), 10U );
+		ASSERT_EQ( movement.visited.size(), 10U );
+		ASSERT_EQ( world.get<FusedPosition>( EntityId{4U} ).x, 5.0F ); //< Gravity applied before movement
+	}
+
+} //END: Test
+} //END: SubzeroECS
@@ -0,0 +1,173 @@
+#include "SubzeroECS/World.hpp"
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/View.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace SubzeroECS {
+	namespace Test {
+
+		/** Collect the entity ids visited by a view */
+		template< typename ViewType >
+		std::vector<EntityId> viewIds( ViewType& view )
+		{
+			std::vector<EntityId> ids;
+			for ( auto iEntity = view.begin(); iEntity != view.end(); ++iEntity )
+				ids.push_back( iEntity );
+			return ids;
+		}
+
+		TEST( Group, RegisteredInRegistry )
+		{
+			World world;
+			Collection<Human,Hat> collections(world);
+
+			CollectionRegistry& registry = world;
+			ASSERT_EQ( (registry.find<Human,Hat>()), &collections );
+			ASSERT_EQ( (registry.find<Hat,Human>()), nullptr ); //< Group is order specific
+
+			View<Human,Hat> view(world);
+			ASSERT_EQ( view.group(), &collections.group() );
+		}
+
+		TEST( Group, Rows )
+		{
+			World world;
+			Collection<Human,Hat> collections(world);
+
+			for ( auto id : { 1U, 2U, 3U, 4U, 5U, 8U, 9U } ) world.add( EntityId{id}, Human() );
+			for ( auto id : { 1U, 5U, 6U, 7U, 8U, 9U } ) world.add( EntityId{id}, Hat() );
+
+			const auto& rows = collections.group().sync();
+			ASSERT_EQ( rows.size(), 4U );
+			for ( const auto& row : rows )
+			{
+				EXPECT_EQ( *(collections.get<Human>().begin() + row[0]), *(collections.get<Hat>().begin() + row[1]) );
+			}
+		}
+
+		TEST( Group, ViewMatchesIntersection )
+		{
+			World world;
+			Collection<Age,Health,Shoes> collections(world);
+			View<Age,Health,Shoes> groupView(world);
+			View<Shoes,Health,Age> intersectView(world); //< Different order has no group
+			ASSERT_EQ( intersectView.group(), nullptr );
+
+			for ( auto id : { 1U, 2U, 3U, 4U, 5U, 8U } ) world.add( EntityId{id}, Age{id} );
+			for ( auto id : { 3U, 5U, 6U, 7U, 8U, 9U, 10U  } ) world.add( EntityId{id}, Health{id*2.0F} );
+			for ( auto id : { 1U, 3U, 5U, 8U, 9U } ) world.add( EntityId{id}, Shoes{id*3.0F} );
+
+			ASSERT_EQ( viewIds(groupView), viewIds(intersectView) );
+
+			auto iEntity = groupView.begin();
+			for ( auto expected : { 3U, 5U, 8U } )
+			{
+				EXPECT_EQ( iEntity.get<Age>(), Age{expected} );
+				EXPECT_EQ( iEntity.get<Health>(), Health{expected*2.0F} );
+				EXPECT_EQ( iEntity.get<Shoes>(), Shoes{expected*3.0F} );
+				++iEntity;
+			}
+			EXPECT_EQ( groupView.end(), iEntity );
+		}
+
+		TEST( Group, SyncAppendedEntities )
+		{
+			World world;
+			Collection<Health,Hat> collections(world);
+			View<Health,Hat> view(world);
+
+			(void)world.create( Health{1.0F}, Hat() );
+			(void)world.create( Health{2.0F} );
+			ASSERT_EQ( viewIds(view).size(), 1U );
+
+			// Append new entities and complete a partial entity with a later component
+			Entity partial = world.create( Health{3.0F} );
+			(void)world.create( Health{4.0F}, Hat() );
+			world.add( partial.id(), Hat() );
+			ASSERT_EQ( viewIds(view).size(), 3U );
+			ASSERT_EQ( collections.group().size(), 3U );
+		}
+
+		TEST( Group, SyncInsertedEntities )
+		{
+			World world;
+			Collection<Health,Hat> collections(world);
+			View<Health,Hat> view(world);
+
+			for ( auto id : { 2U, 4U, 6U } ) world.add( EntityId{id}, Health{float(id)} );
+			for ( auto id : { 4U, 6U } ) world.add( EntityId{id}, Hat() );
+			ASSERT_EQ( viewIds(view), (std::vector<EntityId>{ EntityId{4U}, EntityId{6U} }) );
+
+			// Insert before existing entities so column positions shift
+			world.add( EntityId{1U}, Health{1.0F} );
+			world.add( EntityId{1U}, Hat() );
+			world.add( EntityId{2U}, Hat() );
+			ASSERT_EQ( viewIds(view), (std::vector<EntityId>{ EntityId{1U}, EntityId{2U}, EntityId{4U}, EntityId{6U} }) );
+
+			auto iEntity = view.begin();
+			for ( auto expected : { 1U, 2U, 4U, 6U } )
+			{
+				EXPECT_EQ( iEntity.get<Health>(), Health{float(expected)} );
+				++iEntity;
+			}
+		}
+
+		TEST( Group, SyncRemoveThenCreateMany )
+		{
+			World world;
+			Collection<Age,Shoes> collections(world);
+			View<Age,Shoes> view(world);
+
+			for ( auto id : { 2U, 4U, 6U, 8U } ) world.add( EntityId{id}, Age{id} );
+			for ( auto id : { 2U, 4U, 6U, 8U } ) world.add( EntityId{id}, Shoes{float(id)} );
+			ASSERT_EQ( collections.group().sync().size(), 4U );
+
+			// Size grows by as many entities as the version would with one bump per bulk call
+			Collection<Shoes>& shoes = collections.get<Shoes>();
+			ASSERT_TRUE( shoes.remove( EntityId{4U} ) );
+			const EntityId createdIds[] = { EntityId{3U}, EntityId{10U}, EntityId{11U} };
+			Shoes created[] = { Shoes{3.0F}, Shoes{10.0F}, Shoes{11.0F} };
+			shoes.createMany( createdIds, created );
+
+			std::vector<EntityId> visited;
+			view.each( [&]( EntityId entityId, const Age& age, const Shoes& shoe )
+			{
+				EXPECT_EQ( age, Age{entityId.value} );
+				EXPECT_EQ( shoe, Shoes{float(entityId.value)} );
+				visited.push_back( entityId );
+			} );
+			EXPECT_EQ( visited, (std::vector<EntityId>{ EntityId{2U}, EntityId{6U}, EntityId{8U} }) );
+		}
+
+		TEST( Group, SyncRemoveThenCreateRange )
+		{
+			World world;
+			Collection<Age,Shoes> collections(world);
+			View<Age,Shoes> view(world);
+
+			for ( auto id : { 2U, 4U, 6U, 8U, 10U } ) world.add( EntityId{id}, Age{id} );
+			for ( auto id : { 2U, 4U, 6U, 8U } ) world.add( EntityId{id}, Shoes{float(id)} );
+			ASSERT_EQ( collections.group().sync().size(), 4U );
+
+			// Last id keeps its position while the size grows by one per change
+			Collection<Shoes>& shoes = collections.get<Shoes>();
+			ASSERT_TRUE( shoes.remove( EntityId{4U} ) );
+			world.add( EntityId{3U}, Shoes{3.0F} );
+			(void)shoes.createRange( EntityRange{ EntityId{10U}, 3U }, Shoes{10.0F} );
+
+			std::vector<EntityId> visited;
+			view.each( [&]( EntityId entityId, const Age& age, const Shoes& shoe )
+			{
+				EXPECT_EQ( age, Age{entityId.value} );
+				EXPECT_EQ( shoe, Shoes{float(entityId.value)} );
+				visited.push_back( entityId );
+			} );
+			EXPECT_EQ( visited, (std::vector<EntityId>{ EntityId{2U}, EntityId{6U}, EntityId{8U}, EntityId{10U} }) );
+		}
+
+	} //END: Test
+} //END: SubzeroECS
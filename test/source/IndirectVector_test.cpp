@@ -0,0 +1,151 @@
+#include "SubzeroECS/Utility/IndirectVector.hpp"
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/View.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace SubzeroECS {
+	namespace Test
+	{
+		/** Heavy component stored using the indirect storage policy */
+		struct Dialogue
+		{
+			std::string speaker;
+			std::vector<std::string> lines;
+		};
+	}
+
+	template<> struct ComponentStorage<Test::Dialogue> : IndirectStorage<256U> {};
+
+	namespace Test
+	{
+		using SmallPool = Utility::IndirectVector<std::string, 64U>; //< 2 elements per page
+
+		TEST(IndirectVector, InsertErase)
+		{
+			SmallPool vector;
+			for ( const char* text : { "b", "d", "e" } ) vector.push_back( text );
+			vector.insert( vector.begin(), std::string("a") );
+			vector.insert( vector.begin() + 2, std::string("c") );
+			ASSERT_EQ( std::vector<std::string>( vector.begin(), vector.end() ), (std::vector<std::string>{ "a", "b", "c", "d", "e" }) );
+
+			vector.erase( vector.begin() + 1 );
+			vector.erase( vector.end() - 1 );
+			ASSERT_EQ( std::vector<std::string>( vector.begin(), vector.end() ), (std::vector<std::string>{ "a", "c", "d" }) );
+			ASSERT_EQ( vector.at( 1U ), "c" );
+			ASSERT_THROW( vector.at( 3U ), std::out_of_range );
+		}
+
+		TEST(IndirectVector, BulkInsertErase)
+		{
+			SmallPool vector;
+			for ( const char* text : { "b", "d", "f" } ) vector.push_back( text );
+			const std::string* d = &vector[1U];
+
+			std::vector<std::string> values{ "a", "c", "e", "g" };
+			const std::size_t positions[] = { 0U, 1U, 2U, 3U };
+			vector.insertMany( positions, values );
+			ASSERT_EQ( std::vector<std::string>( vector.begin(), vector.end() ), (std::vector<std::string>{ "a", "b", "c", "d", "e", "f", "g" }) );
+
+			const std::size_t erased[] = { 0U, 2U, 4U, 5U };
+			vector.eraseMany( erased );
+			ASSERT_EQ( std::vector<std::string>( vector.begin(), vector.end() ), (std::vector<std::string>{ "b", "d", "g" }) );
+			ASSERT_EQ( &vector[1U], d );
+		}
+
+		TEST(IndirectVector, StableAddressAndSlotReuse)
+		{
+			SmallPool vector;
+			vector.push_back( "first" );
+			const std::string* first = &vector[0U];
+			for ( int i = 0; i < 20; ++i ) vector.insert( vector.begin(), std::to_string(i) );
+			ASSERT_EQ( &vector.back(), first );
+			const std::size_t capacity = vector.capacity();
+
+			// Erased slots are reused without growing the pool
+			for ( int i = 0; i < 10; ++i ) vector.erase( vector.begin() );
+			for ( int i = 0; i < 10; ++i ) vector.insert( vector.begin() + 5, std::string("again") );
+			ASSERT_EQ( vector.capacity(), capacity );
+			ASSERT_EQ( vector.size(), 21U );
+			ASSERT_EQ( &vector.back(), first );
+
+			vector.clear();
+			ASSERT_TRUE( vector.empty() );
+			ASSERT_EQ( vector.capacity(), capacity );
+			vector.push_back( "reused" );
+			ASSERT_EQ( vector.handles()[0], 0U );
+		}
+
+		TEST(IndirectVector, CollectionStorage)
+		{
+			CollectionRegistry registry;
+			Collection<Dialogue> collection( registry );
+			static_assert( std::is_same_v<Collection<Dialogue>::ComponentVector, Utility::IndirectVector<Dialogue, 256U>> );
+
+			// Insert in descending order so every create lands at the front of the column
+			Dialogue* last = collection.create( EntityId{99U}, Dialogue{ "npc99", { "hello" } } );
+			for ( uint32_t id = 98U; id < 99U; --id ) collection.create( EntityId{id}, Dialogue{ "npc" + std::to_string(id), { "line" } } );
+			ASSERT_EQ( last, collection.find( EntityId{99U} ) );
+			ASSERT_EQ( collection.get( EntityId{42U} ).speaker, "npc42" );
+
+			ASSERT_TRUE( collection.remove( EntityId{0U} ) );
+			const EntityId removed[] = { EntityId{10U}, EntityId{11U}, EntityId{50U} };
+			ASSERT_EQ( collection.removeMany( removed ), 3U );
+			ASSERT_EQ( collection.size(), 96U );
+
+			View<Dialogue> view( registry );
+			size_t count = 0U;
+			view.each( [&]( EntityId entityId, Dialogue& dialogue )
+			{
+				ASSERT_EQ( dialogue.speaker, "npc" + std::to_string( entityId.value ) );
+				++count;
+			});
+			ASSERT_EQ( count, 96U );
+		}
+
+		TEST(IndirectVector, CollectionPointerStability)
+		{
+			CollectionRegistry registry;
+			Collection<Dialogue> collection( registry );
+			static_assert( Collection<Dialogue>::HasStableComponents );
+			for ( uint32_t id = 0U; id < 100U; id += 2U ) collection.create( EntityId{id}, Dialogue{ "npc" + std::to_string(id), {} } );
+
+			std::vector<Dialogue*> pointers;
+			for ( uint32_t id = 0U; id < 100U; id += 2U ) pointers.push_back( collection.find( EntityId{id} ) );
+
+			// Bulk changes shift the handles, never the components
+			const EntityId removed[] = { EntityId{0U}, EntityId{10U}, EntityId{12U}, EntityId{50U}, EntityId{98U} };
+			ASSERT_EQ( collection.removeMany( removed ), 5U );
+			std::vector<EntityId> odd;
+			std::vector<Dialogue> created;
+			for ( uint32_t id = 1U; id < 100U; id += 10U )
+			{
+				odd.push_back( EntityId{id} );
+				created.push_back( Dialogue{ "npc" + std::to_string(id), {} } );
+			}
+			collection.createMany( odd, created );
+			ASSERT_EQ( collection.size(), 55U );
+
+			for ( uint32_t id = 0U; id < 100U; id += 2U )
+			{
+				Dialogue* dialogue = collection.find( EntityId{id} );
+				if ( std::find( std::begin(removed), std::end(removed), EntityId{id} ) != std::end(removed) )
+				{
+					ASSERT_EQ( dialogue, nullptr );
+					continue;
+				}
+				ASSERT_EQ( dialogue, pointers[id / 2U] );
+				ASSERT_EQ( dialogue->speaker, "npc" + std::to_string(id) );
+			}
+			for ( const EntityId entityId : odd )
+				ASSERT_EQ( collection.get( entityId ).speaker, "npc" + std::to_string( entityId.value ) );
+		}
+
+	} //END: Test
+} //END: SubzeroECS
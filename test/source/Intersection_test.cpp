@@ -603,5 +603,60 @@ namespace SubzeroECS {
 			ASSERT_EQ(*std::get<2>(iterators), EntityId(500));
 		}
 
+		TEST(IntersectionTest, Runtime_MatchesIntersectN)
+		{
+			auto vec1 = makeEntityIds({1, 5, 10, 100, 200, 500, 1000});
+			auto vec2 = makeEntityIds({5, 100, 150, 500, 600, 1000, 2000});
+			auto vec3 = makeEntityIds({0, 5, 100, 400, 500, 999});
+
+			std::vector<Intersection::Cursor> cursors = {
+				{ vec1.data(), vec1.data() + vec1.size() },
+				{ vec2.data(), vec2.data() + vec2.size() },
+				{ vec3.data(), vec3.data() + vec3.size() } };
+
+			std::vector<EntityId> found;
+			if (Intersection::beginRuntime(cursors))
+			{
+				do
+				{
+					ASSERT_EQ(*cursors[1].it, *cursors[0].it);
+					ASSERT_EQ(*cursors[2].it, *cursors[0].it);
+					found.push_back(*cursors[0].it);
+				}
+				while (Intersection::incrementRuntime(cursors));
+			}
+			ASSERT_EQ(found, makeEntityIds({5, 100, 500}));
+
+			// Single cursor visits every id, an empty column yields nothing
+			std::vector<Intersection::Cursor> single = { { vec1.data(), vec1.data() + vec1.size() } };
+			std::size_t count = 0;
+			if (Intersection::beginRuntime(single))
+			{
+				do { ++count; } while (Intersection::incrementRuntime(single));
+			}
+			ASSERT_EQ(count, vec1.size());
+
+			std::vector<Intersection::Cursor> empty = { { vec1.data(), vec1.data() + vec1.size() }, { vec2.data(), vec2.data() } };
+			ASSERT_FALSE(Intersection::beginRuntime(empty));
+		}
+
+		TEST(IntersectionTest, GallopLowerBound_AllHints)
+		{
+			auto ids = makeEntityIds({2, 3, 5, 8, 13, 21, 34, 55, 89});
+			auto key = [&](std::size_t i) { return ids[i]; };
+
+			// Every hint position must agree with std::lower_bound
+			for (uint32_t value = 0; value != 100; ++value)
+			{
+				const auto expected = static_cast<std::size_t>(std::lower_bound(ids.begin(), ids.end(), EntityId(value)) - ids.begin());
+				for (std::size_t hint = 0; hint <= ids.size() + 1; ++hint)
+				{
+					ASSERT_EQ(Intersection::gallopLowerBound(ids.size(), hint, EntityId(value), key), expected)
+						<< "value " << value << " hint " << hint;
+				}
+			}
+			ASSERT_EQ(Intersection::gallopLowerBound(0, 0, EntityId(1), key), 0U);
+		}
+
 	} // namespace Test
 } // namespace SubzeroECS
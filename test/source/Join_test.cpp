@@ -0,0 +1,75 @@
+#include "SubzeroECS/World.hpp"
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/Join.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace SubzeroECS {
+namespace Test {
+
+	struct Target
+	{
+		EntityId id;
+	};
+
+	TEST(Join, Each)
+	{
+		World world;
+		Collection<Target, Health, Shoes> collections(world);
+
+		Entity entityA = world.create( Health{10.0F}, Shoes{1.0F} );
+		Entity entityB = world.create( Health{20.0F} );
+		Entity entityC = world.create( Target{entityB.id()} );
+		Entity entityD = world.create( Target{entityA.id()} );
+		Entity entityE = world.create( Target{EntityId{100U}} ); //< Dangling reference
+
+		Join< Via<&Target::id>, Health > join(world);
+		std::vector<EntityId> visited;
+		join.each( [&]( EntityId entityId, Target& target, Health& health )
+		{
+			EXPECT_EQ( &health, world.find<Health>( target.id ) );
+			visited.push_back( entityId );
+		});
+		EXPECT_EQ( visited, (std::vector<EntityId>{ entityC.id(), entityD.id() }) );
+
+		// Referenced entity must have all foreign components
+		Join< Via<&Target::id>, Health, Shoes > joinShoes(world);
+		visited.clear();
+		joinShoes.each( [&]( EntityId entityId, Target&, Health& health, Shoes& shoes )
+		{
+			health.percent += shoes.size;
+			visited.push_back( entityId );
+		});
+		EXPECT_EQ( visited, (std::vector<EntityId>{ entityD.id() }) );
+		EXPECT_EQ( entityA.get<Health>().percent, 11.0F );
+		(void)entityE;
+	}
+
+	TEST(Join, EachView_Chunks)
+	{
+		World world;
+		Collection<Target, Age> collections(world);
+
+		// More referencing entities than a single chunk, each referencing its predecessor in reverse order
+		using TargetAgeJoin = Join< Via<&Target::id>, Age >;
+		constexpr uint32_t Count = static_cast<uint32_t>( TargetAgeJoin::ChunkSize ) + 1000U;
+		std::vector<EntityId> aged;
+		for ( uint32_t i = 0U; i != Count; ++i ) aged.push_back( world.create( Age{i} ).id() );
+		for ( uint32_t i = 0U; i != Count; ++i ) (void)world.create( Target{aged[Count - 1U - i]}, Age{i} );
+
+		View<Age, Target> view(world);
+		TargetAgeJoin join(world);
+		uint32_t visited = 0U;
+		join.each( view, [&]( const View<Age, Target>::Iterator& iEntity, Age& targetAge )
+		{
+			EXPECT_EQ( iEntity.get<Age>().age + targetAge.age, Count - 1U );
+			++visited;
+		});
+		EXPECT_EQ( visited, Count );
+	}
+
+} //END: Test
+} //END: SubzeroECS
@@ -0,0 +1,120 @@
+#include "SubzeroECS/Utility/MappedVector.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/Has.hpp"
+#include "SubzeroECS/Logical.hpp"
+#include "SubzeroECS/View.hpp"
+#include "SubzeroECS/World.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+namespace SubzeroECS {
+	namespace Test
+	{
+		/** Components stored using the memory-mapped file storage policy */
+		struct MappedHealth
+		{
+			float percent;
+		};
+
+		struct MappedAge
+		{
+			uint32_t age;
+		};
+	}
+
+	template<> struct ComponentStorage<Test::MappedHealth> : MappedFileStorage {};
+	template<> struct ComponentStorage<Test::MappedAge> : MappedFileStorage {};
+
+	namespace Test
+	{
+		using Mapped = Utility::MappedVector<uint32_t>;
+
+		TEST(MappedVector, Empty)
+		{
+			Mapped vector;
+			ASSERT_TRUE( vector.empty() );
+			ASSERT_EQ( vector.data(), nullptr ); //< No file until the first growth
+			ASSERT_EQ( vector.begin(), vector.end() );
+			vector.adviseSequential();
+		}
+
+		TEST(MappedVector, GrowPreservesContents)
+		{
+			Mapped vector;
+			const std::size_t count = 3U * Mapped::MinimumBytes / sizeof(uint32_t); //< Grows by remapping twice
+			for ( uint32_t i = 0U; i < count; ++i ) vector.push_back( i );
+
+			ASSERT_EQ( vector.size(), count );
+			ASSERT_GE( vector.capacity(), count );
+			for ( uint32_t i = 0U; i < count; ++i ) ASSERT_EQ( vector[i], i );
+			ASSERT_THROW( vector.at( count ), std::out_of_range );
+			vector.adviseSequential();
+		}
+
+		TEST(MappedVector, InsertErase)
+		{
+			Mapped vector;
+			for ( uint32_t i : { 1U, 2U, 4U } ) vector.push_back( i );
+			vector.insert( vector.begin() + 2, 3U );
+			vector.insert( vector.begin(), 0U );
+			vector.insert( vector.end(), 5U );
+			for ( uint32_t i = 0U; i < 6U; ++i ) ASSERT_EQ( vector[i], i );
+
+			vector.erase( vector.begin() + 1 );
+			ASSERT_EQ( vector.size(), 5U );
+			ASSERT_EQ( vector[1], 2U );
+			vector.resize( 7U );
+			ASSERT_EQ( vector[6], 0U ); //< Value initialised
+			vector.clear();
+			ASSERT_TRUE( vector.empty() );
+		}
+
+		TEST(MappedVector, Move)
+		{
+			Mapped vector;
+			vector.push_back( 7U );
+			Mapped moved( std::move(vector) );
+			ASSERT_EQ( moved.size(), 1U );
+			ASSERT_EQ( moved[0], 7U );
+			ASSERT_TRUE( vector.empty() );
+		}
+
+		TEST(MappedVector, CollectionStorage)
+		{
+			World world;
+			Collection<MappedHealth> healthCollection( world );
+			Collection<MappedAge> ageCollection( world );
+			static_assert( std::is_same_v<Collection<MappedHealth>::ComponentVector, Utility::MappedVector<MappedHealth>> );
+			static_assert( std::is_same_v<Collection<MappedHealth>::EntityIdVector, Utility::MappedVector<EntityId>> );
+
+			for ( uint32_t i = 0U; i < 100U; ++i )
+			{
+				Entity entity = world.create( MappedHealth{ float(i) } );
+				if ( i % 2U == 0U ) world.add( entity.id(), MappedAge{i} );
+			}
+			ASSERT_EQ( world.get<MappedHealth>( EntityId{42U} ).percent, 42.0F );
+			ASSERT_TRUE( world.remove<MappedHealth>( EntityId{42U} ) );
+
+			std::size_t count = 0U;
+			View<MappedHealth, MappedAge> view( world );
+			view.each( [&]( const MappedHealth& health, const MappedAge& age )
+			{
+				ASSERT_EQ( health.percent, float(age.age) );
+				++count;
+			});
+			ASSERT_EQ( count, 49U );
+
+			// Queries iterate the mapped ids of the smallest collection
+			ASSERT_EQ( world.count( Has<MappedAge>() ), 50U );
+			ASSERT_EQ( world.count( Has<MappedHealth>() && Has<MappedAge>() ), 49U );
+			ASSERT_TRUE( world.any( Has<MappedAge>() ) );
+		}
+
+	} //END: Test
+} //END: SubzeroECS
+
+#endif // defined(__unix__) || defined(__APPLE__)
@@ -0,0 +1,117 @@
+#include "SubzeroECS/Utility/PagedVector.hpp"
+#include "SubzeroECS/Collection.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <string>
+
+namespace SubzeroECS {
+	namespace Test
+	{
+		/** Component stored using the paged storage policy */
+		struct PagedHealth
+		{
+			float percent;
+		};
+	}
+
+	template<> struct ComponentStorage<Test::PagedHealth> : PagedStorage<64U> {};
+
+	namespace Test
+	{
+		using SmallPages = Utility::PagedVector<uint32_t, 16U>; //< 4 elements per page
+
+		TEST(PagedVector, PageSize)
+		{
+			ASSERT_EQ( SmallPages::PageSize, 4U );
+			ASSERT_EQ( (Utility::PagedVector<uint32_t, 15U>::PageSize), 2U ); //< Rounded down to power of two
+			ASSERT_EQ( (Utility::PagedVector<uint64_t, 1U>::PageSize), 1U ); //< Minimum single element
+		}
+
+		TEST(PagedVector, PushBack)
+		{
+			SmallPages vector;
+			for ( uint32_t i = 0U; i < 10U; ++i ) vector.push_back( i );
+
+			ASSERT_EQ( vector.size(), 10U );
+			ASSERT_EQ( vector.pageCount(), 3U );
+			for ( uint32_t i = 0U; i < 10U; ++i ) EXPECT_EQ( vector[i], i );
+		}
+
+		TEST(PagedVector, StableAddressOnGrowth)
+		{
+			SmallPages vector;
+			vector.push_back( 123U );
+			const uint32_t* first = &vector[0U];
+
+			for ( uint32_t i = 0U; i < 1000U; ++i ) vector.push_back( i );
+			ASSERT_EQ( first, &vector[0U] );
+			ASSERT_EQ( *first, 123U );
+		}
+
+		TEST(PagedVector, Insert)
+		{
+			SmallPages vector;
+			for ( uint32_t i : { 0U, 1U, 2U, 4U, 5U, 6U } ) vector.push_back( i );
+			vector.insert( vector.begin() + 3, 3U );
+			vector.insert( vector.end(), 7U );
+			vector.insert( vector.begin(), 99U );
+
+			const uint32_t expected[] = { 99U, 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U };
+			ASSERT_TRUE( std::equal( vector.begin(), vector.end(), std::begin(expected), std::end(expected) ) );
+		}
+
+		TEST(PagedVector, Erase)
+		{
+			SmallPages vector;
+			for ( uint32_t i = 0U; i < 6U; ++i ) vector.push_back( i );
+			vector.erase( vector.begin() + 1 );
+
+			const uint32_t expected[] = { 0U, 2U, 3U, 4U, 5U };
+			ASSERT_TRUE( std::equal( vector.begin(), vector.end(), std::begin(expected), std::end(expected) ) );
+		}
+
+		TEST(PagedVector, Pages)
+		{
+			SmallPages vector;
+			for ( uint32_t i = 0U; i < 10U; ++i ) vector.push_back( i );
+
+			uint32_t sum = 0U;
+			for ( size_t iPage = 0U; iPage < vector.pageCount(); ++iPage )
+			{
+				auto page = vector.page( iPage );
+				ASSERT_EQ( page.size(), iPage < 2U ? 4U : 2U );
+				sum = std::accumulate( page.begin(), page.end(), sum );
+			}
+			ASSERT_EQ( sum, 45U );
+		}
+
+		TEST(PagedVector, ClearRetainsPages)
+		{
+			Utility::PagedVector<std::string, 64U> vector;
+			for ( int i = 0; i < 10; ++i ) vector.push_back( std::to_string(i) );
+			const size_t capacity = vector.capacity();
+
+			vector.clear();
+			ASSERT_TRUE( vector.empty() );
+			ASSERT_EQ( vector.capacity(), capacity );
+		}
+
+		TEST(PagedVector, CollectionStorage)
+		{
+			CollectionRegistry registry;
+			Collection<PagedHealth> collection( registry );
+			static_assert( std::is_same_v<Collection<PagedHealth>::ComponentVector, Utility::PagedVector<PagedHealth, 64U>> );
+
+			PagedHealth* first = collection.create( EntityId{0U}, PagedHealth{50.0F} );
+			for ( uint32_t id = 1U; id < 100U; ++id ) collection.create( EntityId{id}, PagedHealth{float(id)} );
+
+			ASSERT_EQ( first, collection.find( EntityId{0U} ) );
+			ASSERT_EQ( first->percent, 50.0F );
+			ASSERT_EQ( collection.get( EntityId{42U} ).percent, 42.0F );
+		}
+
+	} //END: Test
+} //END: SubzeroECS
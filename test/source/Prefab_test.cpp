@@ -0,0 +1,72 @@
+#include "SubzeroECS/Prefab.hpp"
+#include "SubzeroECS/StaticWorld.hpp"
+#include "SubzeroECS/World.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+namespace SubzeroECS {
+namespace Test {
+
+	TEST(Prefab, Get)
+	{
+		Prefab prefab( Age{3U}, Health{50.0F} );
+		ASSERT_EQ( prefab.get<Age>().age, 3U );
+		prefab.get<Health>().percent = 75.0F;
+		ASSERT_EQ( std::as_const(prefab).get<Health>().percent, 75.0F );
+	}
+
+	TEST(Prefab, InstantiateWorld)
+	{
+		World world;
+		Collection<Age, Health, Shoes> collections( world );
+		const Entity existing = world.create( Age{99U}, Shoes{9.0F} );
+
+		const Prefab prefab( Age{1U}, Health{100.0F} );
+		const EntityRange entities = world.instantiate( prefab, 1000U );
+		ASSERT_EQ( entities.count, 1000U );
+		ASSERT_FALSE( entities.contains( existing.id() ) );
+		ASSERT_EQ( world.CollectionRegistry::get<Age>().size(), 1001U );
+		ASSERT_EQ( world.CollectionRegistry::get<Health>().size(), 1000U );
+		ASSERT_EQ( world.CollectionRegistry::get<Shoes>().size(), 1U );
+		for ( std::size_t i = 0U; i < entities.count; ++i )
+		{
+			ASSERT_EQ( world.get<Age>( entities[i] ).age, 1U );
+			ASSERT_EQ( world.get<Health>( entities[i] ).percent, 100.0F );
+		}
+
+		// Instances are ordinary entities
+		ASSERT_TRUE( world.remove<Health>( entities[10] ) );
+		world.add( entities[10], Shoes{4.0F} );
+		ASSERT_TRUE( world.has<Shoes>( entities[10] ) );
+		ASSERT_GT( world.create().id(), entities[999] );
+
+		const EntityRange none = world.instantiate( prefab, 0U );
+		ASSERT_EQ( none.count, 0U );
+		ASSERT_EQ( world.CollectionRegistry::get<Age>().size(), 1001U );
+	}
+
+	TEST(Prefab, InstantiateStaticWorldWithInit)
+	{
+		StaticWorld<Age, Health> world;
+		world.create( Age{7U} );
+
+		std::size_t calls = 0U;
+		const EntityRange entities = world.instantiate( Prefab( Age{0U}, Health{10.0F} ), 100U
+			, [&]( EntityId entityId, Age& age, Health& health )
+			{
+				age.age = entityId.value;
+				health.percent += 1.0F;
+				++calls;
+			});
+		ASSERT_EQ( calls, 100U );
+		for ( std::size_t i = 0U; i < entities.count; ++i )
+		{
+			ASSERT_EQ( world.get<Age>( entities[i] ).age, entities[i].value );
+			ASSERT_EQ( world.get<Health>( entities[i] ).percent, 11.0F );
+		}
+		ASSERT_EQ( world.get<Age>().size(), 101U );
+	}
+
+} //END: Test
+} //END: SubzeroECS
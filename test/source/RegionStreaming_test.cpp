@@ -0,0 +1,184 @@
+#include "SubzeroECS/RegionStreaming.hpp"
+#include "SubzeroECS/StaticWorld.hpp"
+#include "SubzeroECS/World.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace SubzeroECS {
+namespace Test {
+
+	using RegionWorld = StaticWorld<Age, Health>;
+
+	/** Region of count entities where every entity has an Age and every other a Health */
+	static std::vector<std::byte> makeRegion( std::uint32_t count, std::uint32_t ageOffset )
+	{
+		RegionWorld source;
+		std::vector<EntityId> entityIds;
+		for ( std::uint32_t i = 0U; i < count; ++i )
+		{
+			const EntityId entityId = source.create( Age{ageOffset + i} );
+			if ( i % 2U == 0U )
+				source.add( entityId, Health{ static_cast<float>(i) } );
+			entityIds.push_back( entityId );
+		}
+		return encodeRegion<Age, Health>( source, entityIds );
+	}
+
+	/** Update until every region is spliced, failing if any update exceeds the entity budget */
+	template< typename Streamer >
+	static std::size_t streamAll( Streamer& streamer, std::size_t maxEntities )
+	{
+		std::size_t updates = 0U;
+		while ( streamer.pendingCount() != 0U )
+		{
+			EXPECT_LE( streamer.update( SliceBudget{ .maxEntities = maxEntities } ), maxEntities );
+			++updates;
+		}
+		return updates;
+	}
+
+	TEST(RegionStreaming, EncodeDecode)
+	{
+		RegionWorld world;
+		const EntityId first = world.create( Age{1U}, Health{10.0F} );
+		const EntityId second = world.create( Age{2U} );
+		const EntityId third = world.create( Health{30.0F} );
+		const EntityId entityIds[] = { first, second, third };
+
+		const auto region = decodeRegion<Age, Health>( encodeRegion<Age, Health>( world, entityIds ) );
+		ASSERT_EQ( region.entityCount, 3U );
+
+		const auto& ages = std::get<0>( region.columns );
+		ASSERT_EQ( ages.localIndices, (std::vector<std::uint32_t>{ 0U, 1U }) );
+		ASSERT_EQ( ages.components, (std::vector<Age>{ Age{1U}, Age{2U} }) );
+
+		const auto& healths = std::get<1>( region.columns );
+		ASSERT_EQ( healths.localIndices, (std::vector<std::uint32_t>{ 0U, 2U }) );
+		ASSERT_EQ( healths.components, (std::vector<Health>{ Health{10.0F}, Health{30.0F} }) );
+	}
+
+	TEST(RegionStreaming, DecodeRejectsInvalidRegion)
+	{
+		const std::vector<std::byte> bytes = makeRegion( 4U, 0U );
+		EXPECT_THROW( (decodeRegion<Age>( bytes )), std::invalid_argument );
+		EXPECT_THROW( (decodeRegion<Age, Hat>( bytes )), std::invalid_argument );
+		EXPECT_THROW( (decodeRegion<Age, Health>( std::span( bytes ).first( bytes.size() - 1U ) )), std::invalid_argument );
+		EXPECT_THROW( (decodeRegion<Age, Health>( std::span( bytes ).first( 3U ) )), std::invalid_argument );
+	}
+
+	TEST(RegionStreaming, LoadSplicesWithinBudget)
+	{
+		RegionWorld world;
+		const EntityId existing = world.create( Age{999U}, Health{99.0F} );
+
+		RegionStreamer<RegionWorld, Age, Health> streamer( world );
+		const auto regionId = streamer.load( makeRegion( 5000U, 0U ) );
+		ASSERT_FALSE( streamer.isLoaded( regionId ) );
+
+		ASSERT_GE( streamAll( streamer, 1000U ), 8U );
+		ASSERT_TRUE( streamer.isLoaded( regionId ) );
+
+		const EntityRange entities = streamer.entities( regionId );
+		ASSERT_EQ( entities.count, 5000U );
+		ASSERT_FALSE( entities.contains( existing ) );
+		ASSERT_EQ( world.get<Age>().size(), 5001U );
+		ASSERT_EQ( world.get<Health>().size(), 2501U );
+		ASSERT_EQ( world.get<Age>( existing ).age, 999U );
+
+		for ( std::uint32_t i = 0U; i < 5000U; ++i )
+		{
+			const EntityId entityId{ entities.first.value + i };
+			ASSERT_EQ( world.get<Age>( entityId ).age, i );
+			ASSERT_EQ( world.has<Health>( entityId ), i % 2U == 0U );
+		}
+
+		// Entities created after the region keep appending
+		ASSERT_GT( world.create( Age{0U} ).value, entities.first.value + 4999U );
+	}
+
+	TEST(RegionStreaming, DefaultBudgetLoadsRegion)
+	{
+		using Streamer = RegionStreamer<RegionWorld, Age, Health>;
+		RegionWorld world;
+		Streamer streamer( world );
+		const auto regionId = streamer.load( makeRegion( 5000U, 0U ) );
+		static_assert( 5000U > Streamer::ChunkSize );
+
+		// Once decoded every Age and Health is spliced in a single update
+		std::size_t spliced = 0U;
+		while ( spliced == 0U )
+			spliced = streamer.update();
+		ASSERT_EQ( spliced, 7500U );
+		ASSERT_TRUE( streamer.isLoaded( regionId ) );
+	}
+
+	TEST(RegionStreaming, UnloadRemovesRegionEntities)
+	{
+		World world;
+		Collection<Age, Health> collections( world );
+		const Entity existing = world.create( Age{999U} );
+
+		RegionStreamer<World, Age, Health> streamer( world );
+		const auto firstRegion = streamer.load( makeRegion( 300U, 0U ) );
+		const auto secondRegion = streamer.load( makeRegion( 200U, 1000U ) );
+		streamAll( streamer, 128U );
+
+		// Components added by gameplay go with the region
+		const EntityRange first = streamer.entities( firstRegion );
+		world.add( EntityId{ first.first.value + 1U }, Health{1.0F} );
+
+		ASSERT_TRUE( streamer.unload( firstRegion ) );
+		ASSERT_FALSE( streamer.unload( firstRegion ) );
+		ASSERT_EQ( world.CollectionRegistry::get<Age>().size(), 201U );
+		ASSERT_EQ( world.CollectionRegistry::get<Health>().size(), 100U );
+		ASSERT_EQ( world.get<Age>( existing.id() ).age, 999U );
+
+		const EntityRange second = streamer.entities( secondRegion );
+		for ( std::uint32_t i = 0U; i < 200U; ++i )
+			ASSERT_EQ( world.get<Age>( EntityId{ second.first.value + i } ).age, 1000U + i );
+
+		ASSERT_TRUE( streamer.unload( secondRegion ) );
+		ASSERT_EQ( world.CollectionRegistry::get<Age>().size(), 1U );
+		ASSERT_EQ( world.CollectionRegistry::get<Health>().size(), 0U );
+	}
+
+	TEST(RegionStreaming, UnloadWhileDecoding)
+	{
+		RegionWorld world;
+		RegionStreamer<RegionWorld, Age, Health> streamer( world );
+		const auto regionId = streamer.load( makeRegion( 1000U, 0U ) );
+		ASSERT_TRUE( streamer.unload( regionId ) );
+
+		streamAll( streamer, 100U );
+		ASSERT_EQ( world.get<Age>().size(), 0U );
+		ASSERT_EQ( streamer.entities( regionId ).count, 0U );
+	}
+
+	TEST(RegionStreaming, InvalidRegionThrowsFromUpdate)
+	{
+		RegionWorld world;
+		RegionStreamer<RegionWorld, Age, Health> streamer( world );
+		(void)streamer.load( std::vector<std::byte>( 7U ) );
+
+		bool thrown = false;
+		while ( streamer.pendingCount() != 0U )
+		{
+			try
+			{
+				streamer.update();
+			}
+			catch ( const std::invalid_argument& )
+			{
+				thrown = true;
+			}
+		}
+		ASSERT_TRUE( thrown );
+		ASSERT_EQ( world.get<Age>().size(), 0U );
+	}
+
+} //END: Test
+} //END: SubzeroECS
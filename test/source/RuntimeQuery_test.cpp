@@ -0,0 +1,151 @@
+#include "SubzeroECS/RuntimeQuery.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace SubzeroECS {
+namespace Test {
+
+	/** Registry with script-style Health, Team and Enemy components */
+	class RuntimeQueryFixture : public ::testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			health = registry.registerComponent( ComponentLayout{ "Health", 4U, 4U, { ComponentField{ "value", 0U, 4U, FieldType::Float32 } } } );
+			team = registry.registerComponent( ComponentLayout{ "Team", 8U, 4U, {
+				ComponentField{ "id", 0U, 4U, FieldType::Int32 },
+				ComponentField{ "flags", 4U, 4U, FieldType::UInt32 } } } );
+			enemy = registry.registerComponent( ComponentLayout{ "Enemy", 0U, 1U, {} } );
+		}
+
+		void addHealth( std::uint32_t id, float value )
+		{ registry.get( health ).create( EntityId{id}, &value ); }
+
+		void addTeam( std::uint32_t id, std::int32_t teamId )
+		{
+			const std::int32_t value[2] = { teamId, 0 };
+			registry.get( team ).create( EntityId{id}, value );
+		}
+
+		DynamicComponentRegistry registry;
+		DynamicComponentId health = 0U;
+		DynamicComponentId team = 0U;
+		DynamicComponentId enemy = 0U;
+	};
+
+	TEST_F(RuntimeQueryFixture, Signature)
+	{
+		RuntimeQuery lhs;
+		lhs.where( health, "value", CompareOp::Less, 10.0 ).where( team, "id", CompareOp::Equal, 2.0 ).with( enemy );
+		RuntimeQuery rhs;
+		rhs.with( enemy ).where( team, "id", CompareOp::Equal, 2.0 ).where( health, "value", CompareOp::Less, 10.0 );
+		ASSERT_EQ( lhs.signature(), rhs.signature() );
+		ASSERT_EQ( lhs.components(), (std::vector<DynamicComponentId>{ health, team, enemy }) );
+
+		RuntimeQuery other;
+		other.where( health, "value", CompareOp::Less, 10.5 ).where( team, "id", CompareOp::Equal, 2.0 ).with( enemy );
+		ASSERT_NE( lhs.signature(), other.signature() );
+	}
+
+	TEST_F(RuntimeQueryFixture, MatchesBruteForce)
+	{
+		for ( std::uint32_t i = 0U; i < 1000U; ++i )
+		{
+			addHealth( i, float(i % 50U) );
+			if ( i % 3U != 0U )
+				addTeam( i, std::int32_t(i % 4U) );
+			if ( i % 7U == 0U )
+				registry.get( enemy ).create( EntityId{i} );
+		}
+
+		RuntimeQuery query;
+		query.where( health, "value", CompareOp::Less, 10.0 ).where( team, "id", CompareOp::Equal, 2.0 );
+		QueryPlan plan( registry, query );
+
+		std::vector<EntityId> expected;
+		for ( std::uint32_t i = 0U; i < 1000U; ++i )
+		{
+			if ( i % 50U < 10U && i % 3U != 0U && i % 4U == 2U )
+				expected.push_back( EntityId{i} );
+		}
+		ASSERT_EQ( plan.entities(), expected );
+		ASSERT_EQ( plan.count(), expected.size() );
+
+		// Adding a tag term narrows the result
+		query.with( enemy );
+		QueryPlan tagged( registry, query );
+		std::erase_if( expected, []( EntityId entityId ) { return entityId.value % 7U != 0U; } );
+		ASSERT_EQ( tagged.entities(), expected );
+
+		// Plans see later changes to the collections
+		addHealth( 1000U, 1.0F );
+		addTeam( 1000U, 2 );
+		registry.get( enemy ).create( EntityId{1000U} );
+		expected.push_back( EntityId{1000U} );
+		ASSERT_EQ( tagged.entities(), expected );
+	}
+
+	TEST_F(RuntimeQueryFixture, OrdersBySelectivity)
+	{
+		for ( std::uint32_t i = 0U; i < 1000U; ++i )
+			addHealth( i, float(i) );
+		for ( std::uint32_t i = 0U; i < 20U; ++i )
+			addTeam( i * 50U, std::int32_t(i % 2U) );
+
+		RuntimeQuery query;
+		query.where( health, "value", CompareOp::GreaterEqual, 500.0 ).where( team, "id", CompareOp::NotEqual, 0.0 );
+		QueryPlan plan( registry, query );
+
+		// The small Team column is scanned and drives the intersection, Health is only probed
+		const std::vector<QueryPlan::Step> steps = plan.explain();
+		ASSERT_EQ( steps.size(), 2U );
+		ASSERT_EQ( steps[0].component, team );
+		ASSERT_EQ( steps[0].strategy, QueryPlan::Strategy::Scan );
+		ASSERT_EQ( steps[0].rows, 10U );
+		ASSERT_EQ( steps[1].component, health );
+		ASSERT_EQ( steps[1].strategy, QueryPlan::Strategy::Probe );
+
+		ASSERT_EQ( plan.entities(), (std::vector<EntityId>{ EntityId{550U}, EntityId{650U}, EntityId{750U}, EntityId{850U}, EntityId{950U} }) );
+
+		// Once Team is as large as Health both columns are scanned
+		for ( std::uint32_t i = 0U; i < 1000U; ++i )
+		{
+			if ( i % 50U != 0U )
+				addTeam( i, 1 );
+		}
+		for ( const QueryPlan::Step& step : plan.explain() )
+			ASSERT_EQ( step.strategy, QueryPlan::Strategy::Scan );
+		ASSERT_EQ( plan.count(), 495U );
+	}
+
+	TEST_F(RuntimeQueryFixture, PlanCache)
+	{
+		QueryPlanCache cache( registry );
+		RuntimeQuery lhs;
+		lhs.where( health, "value", CompareOp::Less, 10.0 ).with( enemy );
+		RuntimeQuery rhs;
+		rhs.with( enemy ).where( health, "value", CompareOp::Less, 10.0 );
+
+		QueryPlan& plan = cache.plan( lhs );
+		ASSERT_EQ( &cache.plan( rhs ), &plan );
+		ASSERT_EQ( cache.size(), 1U );
+		ASSERT_EQ( plan.count(), 0U );
+
+		RuntimeQuery unknownField;
+		unknownField.where( health, "armour", CompareOp::Less, 1.0 );
+		ASSERT_THROW( cache.plan( unknownField ), std::invalid_argument );
+		RuntimeQuery unknownComponent;
+		unknownComponent.with( DynamicComponentId{42U} );
+		ASSERT_THROW( cache.plan( unknownComponent ), std::invalid_argument );
+		ASSERT_EQ( cache.size(), 1U );
+
+		cache.clear();
+		ASSERT_EQ( cache.size(), 0U );
+	}
+
+} //END: Test
+} //END: SubzeroECS
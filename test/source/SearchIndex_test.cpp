@@ -0,0 +1,113 @@
+#include "SubzeroECS/CollectionRegistry.hpp"
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/SearchIndex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace SubzeroECS {
+	namespace Test
+	{
+		/** Component with a search index enabled */
+		struct Waypoint { std::uint32_t node; };
+	}
+
+	template<> struct ComponentSearchIndex<Test::Waypoint> : std::true_type {};
+
+	namespace Test
+	{
+		/** Check lowerBound() against std::lower_bound for every value around the ids */
+		static void expectMatchesLowerBound( const std::vector<EntityId>& ids, SearchIndex::Layout layout )
+		{
+			SearchIndex index;
+			index.build( ids );
+			ASSERT_EQ( index.layout(), layout );
+			ASSERT_EQ( index.size(), ids.size() );
+
+			const std::uint32_t last = ids.empty() ? 4U : ids.back().value + 4U;
+			for ( std::uint32_t value = 0U; value <= last; ++value )
+			{
+				const auto expected = std::lower_bound( ids.begin(), ids.end(), EntityId{value} ) - ids.begin();
+				ASSERT_EQ( index.lowerBound( ids, EntityId{value} ), static_cast<std::size_t>(expected) ) << value;
+			}
+		}
+
+		TEST(SearchIndex, Empty)
+		{
+			expectMatchesLowerBound( {}, SearchIndex::Layout::Empty );
+		}
+
+		TEST(SearchIndex, Interpolation)
+		{
+			std::vector<EntityId> ids;
+			for ( std::uint32_t id = 10U; id < 1000U; id += 1U + (id % 3U) )
+				ids.push_back( EntityId{id} );
+			expectMatchesLowerBound( ids, SearchIndex::Layout::Interpolation );
+
+			expectMatchesLowerBound( { EntityId{7U} }, SearchIndex::Layout::Interpolation );
+		}
+
+		TEST(SearchIndex, BTree)
+		{
+			// Partial and full leaves under one and two levels of nodes
+			for ( std::uint32_t count = 1U; count <= 300U; count += (count < 40U) ? 1U : 13U )
+			{
+				std::vector<EntityId> ids;
+				for ( std::uint32_t i = 0U; i < count; ++i )
+					ids.push_back( EntityId{ 5U + i * 37U + (i * i) % 11U } );
+				const SearchIndex::Layout layout = (count == 1U) ? SearchIndex::Layout::Interpolation : SearchIndex::Layout::BTree;
+				expectMatchesLowerBound( ids, layout );
+			}
+
+			// Three levels of nodes
+			std::vector<EntityId> clustered;
+			for ( std::uint32_t id = 0U; id < 5000U; ++id )
+				clustered.push_back( EntityId{ (id < 4000U) ? id : 10000U + id * 13U } );
+			expectMatchesLowerBound( clustered, SearchIndex::Layout::BTree );
+		}
+
+		TEST(SearchIndex, CollectionRebuildsExplicitly)
+		{
+			CollectionRegistry collectionRegistry;
+			Collection<Waypoint> waypoints(collectionRegistry);
+			for ( std::uint32_t id = 0U; id < 1000U; id += 8U )
+				waypoints.create( EntityId{id}, Waypoint{id} );
+
+			// Lookups binary search the ids while the index is stale and never rebuild it
+			ASSERT_FALSE( waypoints.searchIndexCurrent() );
+			ASSERT_EQ( waypoints.find( EntityId{80U} )->node, 80U );
+			ASSERT_FALSE( waypoints.searchIndexCurrent() );
+			ASSERT_EQ( waypoints.searchIndex().size(), 0U );
+
+			waypoints.buildSearchIndex();
+			ASSERT_TRUE( waypoints.searchIndexCurrent() );
+			ASSERT_EQ( waypoints.searchIndex().layout(), SearchIndex::Layout::BTree );
+			ASSERT_EQ( waypoints.find( EntityId{80U} )->node, 80U );
+			ASSERT_EQ( waypoints.find( EntityId{81U} ), nullptr );
+
+			// Structural changes are seen by lookups before the next rebuild
+			waypoints.create( EntityId{81U}, Waypoint{81U} );
+			ASSERT_FALSE( waypoints.searchIndexCurrent() );
+			ASSERT_TRUE( waypoints.has( EntityId{81U} ) );
+			ASSERT_EQ( waypoints.get( EntityId{81U} ).node, 81U );
+			ASSERT_TRUE( waypoints.remove( EntityId{80U} ) );
+			ASSERT_FALSE( waypoints.has( EntityId{80U} ) );
+			ASSERT_THROW( waypoints.get( EntityId{5000U} ), std::invalid_argument );
+			waypoints.buildSearchIndex();
+			ASSERT_EQ( waypoints.searchIndex().size(), waypoints.size() );
+			ASSERT_TRUE( waypoints.has( EntityId{81U} ) );
+			ASSERT_FALSE( waypoints.has( EntityId{80U} ) );
+
+			for ( std::uint32_t id = 1000U; id < 4000U; ++id )
+				waypoints.create( EntityId{id}, Waypoint{id} );
+			waypoints.buildSearchIndex();
+			ASSERT_EQ( waypoints.searchIndex().layout(), SearchIndex::Layout::Interpolation );
+			for ( const EntityId entityId : waypoints.ids() )
+				ASSERT_EQ( waypoints.get( entityId ).node, entityId.value );
+		}
+
+	} //END: Test
+} //END: SubzeroECS
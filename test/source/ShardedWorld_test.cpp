@@ -0,0 +1,175 @@
+#include "SubzeroECS/ShardedWorld.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace SubzeroECS {
+namespace Test {
+
+	using TestShardedWorld = ShardedWorld<Age, Health, Shoes>;
+
+	/** Ages every entity by one year */
+	class ShardAgeSystem : public System<ShardAgeSystem, Age>
+	{
+	public:
+		template< typename WorldType >
+		ShardAgeSystem( WorldType& world )
+		: System<ShardAgeSystem, Age>(world)
+		{}
+
+		void processEntity( Age& age )
+		{ ++age.age; }
+	};
+
+	TEST(ShardedWorld, Construct)
+	{
+		TestShardedWorld world( 4U, 2U );
+		ASSERT_EQ( world.shardCount(), 4U );
+		ASSERT_EQ( world.threadCount(), 2U );
+		ASSERT_EQ( world.queuedCount(), 0U );
+		ASSERT_EQ( world.sync(), 0U );
+	}
+
+	TEST(ShardedWorld, MigrateMovesAllComponents)
+	{
+		TestShardedWorld world( 3U, 2U );
+		TestShardedWorld::WorldType& source = world.shard(0U);
+		const EntityId stay = source.create( Age{1U}, Health{10.0F} );
+		const EntityId leave = source.create( Age{2U}, Shoes{8.0F} );
+		(void)world.shard(2U).create( Age{3U} );
+
+		world.migrate( 0U, leave, 2U );
+		world.migrate( 0U, leave, 2U ); //< Duplicates are moved once
+		world.migrate( 0U, stay, 0U ); //< Same shard is ignored
+		ASSERT_EQ( world.queuedCount(), 2U );
+
+		std::vector<EntityId> newIds;
+		ASSERT_EQ( world.sync( [&]( std::size_t sourceShard, EntityId oldId, std::size_t targetShard, EntityId newId )
+		{
+			ASSERT_EQ( sourceShard, 0U );
+			ASSERT_EQ( oldId, leave );
+			ASSERT_EQ( targetShard, 2U );
+			newIds.push_back( newId );
+		}), 1U );
+		ASSERT_EQ( newIds.size(), 1U );
+		ASSERT_EQ( world.queuedCount(), 0U );
+
+		ASSERT_TRUE( source.has<Age>( stay ) );
+		ASSERT_FALSE( source.has<Age>( leave ) );
+		ASSERT_FALSE( source.has<Shoes>( leave ) );
+		ASSERT_EQ( source.get<Shoes>().size(), 0U );
+
+		TestShardedWorld::WorldType& target = world.shard(2U);
+		ASSERT_EQ( target.get<Age>().size(), 2U );
+		ASSERT_EQ( target.get<Age>( newIds[0] ).age, 2U );
+		ASSERT_EQ( target.get<Shoes>( newIds[0] ).size, 8.0F );
+		ASSERT_FALSE( target.has<Health>( newIds[0] ) );
+	}
+
+	TEST(ShardedWorld, MigrateSkipsStaleIds)
+	{
+		TestShardedWorld world( 3U, 2U );
+		TestShardedWorld::WorldType& source = world.shard(0U);
+		const EntityId emptied = source.create( Age{1U} );
+		const EntityId moved = source.create( Age{2U}, Health{20.0F} );
+		ASSERT_TRUE( source.remove<Age>( emptied ) );
+
+		world.migrate( 0U, emptied, 1U ); //< Entity without components
+		world.migrate( 0U, EntityId{ 99U }, 1U ); //< Id that never existed
+		world.migrate( 0U, moved, 1U );
+		world.migrate( 0U, moved, 2U ); //< Last request wins
+
+		std::vector<EntityId> migrated;
+		ASSERT_EQ( world.sync( [&]( std::size_t, EntityId oldId, std::size_t targetShard, EntityId )
+		{
+			ASSERT_EQ( targetShard, 2U );
+			migrated.push_back( oldId );
+		}), 1U );
+		ASSERT_EQ( migrated, (std::vector<EntityId>{ moved }) );
+		ASSERT_EQ( world.shard(1U).get<Age>().size(), 0U );
+		ASSERT_EQ( world.shard(2U).get<Health>().size(), 1U );
+		ASSERT_EQ( source.get<Age>().size(), 0U );
+	}
+
+	TEST(ShardedWorld, MigrateBatchesFromSeveralShards)
+	{
+		TestShardedWorld world( 3U, 2U );
+		(void)world.shard(2U).create( Age{1000U} );
+		for ( std::size_t shard = 0U; shard < 2U; ++shard )
+		{
+			for ( uint32_t i = 0U; i < 10U; ++i )
+			{
+				const uint32_t age = uint32_t(shard) * 100U + i;
+				const EntityId entityId = (i % 2U == 0U)
+					? world.shard(shard).create( Age{age}, Health{float(age)} )
+					: world.shard(shard).create( Age{age}, Shoes{float(age)} );
+				world.migrate( shard, entityId, 2U );
+			}
+		}
+
+		std::vector<std::pair<uint32_t, EntityId>> arrivals; //< Source age, equal to the shard base plus its id, and new id
+		ASSERT_EQ( world.sync( [&]( std::size_t sourceShard, EntityId oldId, std::size_t targetShard, EntityId newId )
+		{
+			ASSERT_EQ( targetShard, 2U );
+			arrivals.emplace_back( uint32_t(sourceShard) * 100U + oldId.value, newId );
+		}), 20U );
+		ASSERT_EQ( arrivals.size(), 20U );
+
+		TestShardedWorld::WorldType& target = world.shard(2U);
+		ASSERT_EQ( target.get<Age>().size(), 21U );
+		ASSERT_EQ( target.get<Health>().size(), 10U );
+		ASSERT_EQ( target.get<Shoes>().size(), 10U );
+		for ( const auto& [age, newId] : arrivals )
+		{
+			ASSERT_EQ( target.get<Age>( newId ).age, age );
+			if ( age % 2U == 0U )
+				ASSERT_EQ( target.get<Health>( newId ).percent, float(age) );
+			else
+				ASSERT_EQ( target.get<Shoes>( newId ).size, float(age) );
+		}
+		ASSERT_EQ( world.shard(0U).get<Age>().size(), 0U );
+		ASSERT_EQ( world.shard(1U).get<Shoes>().size(), 0U );
+	}
+
+	TEST(ShardedWorld, PartitionBySpatialKey)
+	{
+		constexpr std::size_t ShardCount = 4U;
+		constexpr uint32_t EntitiesPerShard = 50U;
+		TestShardedWorld world( ShardCount, 3U );
+		world.addSystem<ShardAgeSystem>();
+
+		// Shard by age bucket of 50 years
+		auto shardOf = []( const Age& age ) { return (age.age / EntitiesPerShard) % ShardCount; };
+		for ( std::size_t shard = 0U; shard < ShardCount; ++shard )
+		{
+			for ( uint32_t i = 0U; i < EntitiesPerShard; ++i )
+			{
+				(void)world.shard(shard).create( Age{ uint32_t(shard) * EntitiesPerShard + i } );
+			}
+		}
+
+		for ( int step = 0; step < 10; ++step )
+		{
+			world.update();
+			world.partition<Age>( shardOf );
+			ASSERT_EQ( world.sync(), ShardCount ); //< The oldest entity of each shard crosses to the next
+		}
+
+		std::size_t total = 0U;
+		for ( std::size_t shard = 0U; shard < ShardCount; ++shard )
+		{
+			const auto& ages = world.shard(shard).get<Age>().components();
+			total += ages.size();
+			ASSERT_EQ( ages.size(), EntitiesPerShard );
+			for ( const Age& age : ages )
+			{
+				ASSERT_EQ( shardOf( age ), shard );
+			}
+		}
+		ASSERT_EQ( total, ShardCount * EntitiesPerShard );
+	}
+
+} //END: Test
+} //END: SubzeroECS
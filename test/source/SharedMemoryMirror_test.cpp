@@ -0,0 +1,169 @@
+#include "SubzeroECS/SharedMemoryMirror.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include "SubzeroECS/StaticWorld.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace SubzeroECS {
+namespace Test {
+
+	using MirrorWorld = StaticWorld<Age, Health, Shoes>;
+
+	std::string sharedName( const char* test )
+	{ return std::string("/subzero_") + test + "_" + std::to_string( ::getpid() ); }
+
+	TEST(SharedMemoryMirror, PublishAndRead)
+	{
+		MirrorWorld world;
+		for ( uint32_t i = 0U; i < 10U; ++i ) (void)world.create( Age{i}, Health{ float(i) } );
+		(void)world.create( Shoes{9.0F} );
+
+		SharedMemoryWriter<Age, Health> writer( sharedName("PublishAndRead"), 100U );
+		SharedMemoryReader<Age, Health> reader( writer.name() );
+		SharedMemoryReader<Age, Health>::Frame frame;
+		ASSERT_FALSE( reader.read( frame ) ); //< Nothing published yet
+
+		writer.publish( 7U, world );
+		ASSERT_TRUE( reader.read( frame ) );
+		ASSERT_EQ( frame.frame, 7U );
+		ASSERT_EQ( frame.get<Age>().ids, world.get<Age>().ids() );
+		ASSERT_EQ( frame.get<Age>().components, world.get<Age>().components() );
+		ASSERT_EQ( frame.get<Health>().components[3].percent, 3.0F );
+
+		world.get<Age>().remove( EntityId{0U} );
+		const auto sequence = reader.sequence();
+		writer.publish( 8U, world );
+		ASSERT_NE( reader.sequence(), sequence );
+		ASSERT_TRUE( reader.read( frame ) );
+		ASSERT_EQ( frame.get<Age>().ids.size(), 9U );
+		ASSERT_EQ( frame.get<Health>().ids.size(), 10U );
+	}
+
+	TEST(SharedMemoryMirror, ReplacedObjectKeepsReaders)
+	{
+		MirrorWorld world;
+		for ( uint32_t i = 0U; i < 50U; ++i ) (void)world.create( Age{i} );
+
+		std::optional< SharedMemoryWriter<Age> > stale( std::in_place, sharedName("Replaced"), 1000U );
+		stale->publish( 7U, world );
+		SharedMemoryReader<Age> staleReader( stale->name() );
+
+		// A new writer under the same name, smaller than the mapping of the existing reader
+		std::optional< SharedMemoryWriter<Age> > writer( std::in_place, stale->name(), 10U );
+		SharedMemoryReader<Age>::Frame frame;
+		ASSERT_TRUE( staleReader.read( frame ) );
+		ASSERT_EQ( frame.frame, 7U );
+		ASSERT_EQ( frame.get<Age>().components.size(), 50U );
+
+		SharedMemoryReader<Age> reader( writer->name() );
+		ASSERT_FALSE( reader.read( frame ) ); //< New object has nothing published
+		ASSERT_LT( writer->size(), stale->size() );
+
+		writer.reset(); //< Unlinks the name before the stale writer would
+		stale.reset();
+	}
+
+	TEST(SharedMemoryMirror, CapacityAndLayoutChecks)
+	{
+		MirrorWorld world;
+		for ( uint32_t i = 0U; i < 5U; ++i ) (void)world.create( Age{i} );
+
+		SharedMemoryWriter<Age> writer( sharedName("Checks"), 4U );
+		ASSERT_THROW( writer.publish( 1U, world ), std::length_error );
+		ASSERT_THROW( (SharedMemoryReader<Age, Health>( writer.name() )), std::invalid_argument );
+		ASSERT_THROW( (SharedMemoryReader<Health>( writer.name() + "_missing" )), std::system_error );
+	}
+
+	TEST(SharedMemoryMirror, ConcurrentFramesAreConsistent)
+	{
+		MirrorWorld world;
+		for ( uint32_t i = 0U; i < 1000U; ++i ) (void)world.create( Age{0U}, Health{0.0F} );
+
+		SharedMemoryWriter<Age, Health> writer( sharedName("Concurrent"), 1000U );
+		writer.publish( 0U, world );
+
+		std::atomic<bool> done = false;
+		std::thread publisher( [&]()
+		{
+			for ( uint32_t frame = 1U; frame <= 2000U; ++frame )
+			{
+				for ( Age& age : world.get<Age>().components() ) age.age = frame;
+				for ( Health& health : world.get<Health>().components() ) health.percent = float(frame);
+				writer.publish( frame, world );
+			}
+			done = true;
+		});
+
+		SharedMemoryReader<Age, Health> reader( writer.name() );
+		SharedMemoryReader<Age, Health>::Frame frame;
+		std::size_t framesRead = 0U;
+		std::size_t framesTorn = 0U; //< Asserted once the publisher has joined
+		std::size_t framesMissed = 0U; //< Reads overlapping a publish wait for it to complete
+		while ( !done )
+		{
+			if ( !reader.read( frame ) )
+			{
+				++framesMissed;
+				continue;
+			}
+			++framesRead;
+			const bool agesMatch = std::all_of( frame.get<Age>().components.begin(), frame.get<Age>().components.end()
+				, [&]( const Age& age ) { return age.age == frame.frame; } );
+			const bool healthsMatch = std::all_of( frame.get<Health>().components.begin(), frame.get<Health>().components.end()
+				, [&]( const Health& health ) { return health.percent == float(frame.frame); } );
+			if ( !agesMatch || !healthsMatch ) ++framesTorn;
+		}
+		publisher.join();
+		ASSERT_GT( framesRead, 0U );
+		ASSERT_EQ( framesTorn, 0U );
+		ASSERT_EQ( framesMissed, 0U );
+	}
+
+	TEST(SharedMemoryMirror, SecondProcessReads)
+	{
+		MirrorWorld world;
+		for ( uint32_t i = 0U; i < 100U; ++i ) (void)world.create( Age{i * 2U} );
+
+		SharedMemoryWriter<Age> writer( sharedName("SecondProcess"), 100U );
+		writer.publish( 42U, world );
+
+		const pid_t child = ::fork();
+		ASSERT_GE( child, 0 );
+		if ( child == 0 )
+		{
+			// Reader process maps the region by name only
+			int status = 1;
+			try
+			{
+				SharedMemoryReader<Age> reader( writer.name() );
+				SharedMemoryReader<Age>::Frame frame;
+				status = ( reader.read( frame ) && frame.frame == 42U
+					&& frame.get<Age>().components.size() == 100U
+					&& frame.get<Age>().components[99].age == 198U ) ? 0 : 2;
+			}
+			catch ( ... ) {}
+			::_exit( status );
+		}
+
+		int status = -1;
+		ASSERT_EQ( ::waitpid( child, &status, 0 ), child );
+		ASSERT_TRUE( WIFEXITED(status) );
+		ASSERT_EQ( WEXITSTATUS(status), 0 );
+	}
+
+} //END: Test
+} //END: SubzeroECS
+
+#endif // defined(__unix__) || defined(__APPLE__)
@@ -0,0 +1,128 @@
+#include "SubzeroECS/StaticWorld.hpp"
+#include "SubzeroECS/System.hpp"
+#include "SubzeroECS/View.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+namespace SubzeroECS {
+namespace Test {
+
+	/** One-frame input event component */
+	struct InputEvent
+	{
+		uint32_t key;
+	};
+}
+
+	template<> struct ComponentTransient<Test::InputEvent> : std::true_type {};
+
+namespace Test {
+
+	using TestWorld = StaticWorld<Human, Health, Hat, Shoes>;
+
+	TEST(StaticWorld, CreateEntity)
+	{
+		TestWorld world;
+		EntityId entity = world.create();
+		EntityId entityB = world.create();
+		ASSERT_FALSE( isNull(entity) );
+		ASSERT_EQ( entityB.value, entity.value + 1U );
+	}
+
+	TEST(StaticWorld, CreateWithComponents)
+	{
+		TestWorld world;
+		EntityId entity = world.create( Human{}, Health{50.0F}, Hat{} );
+
+		ASSERT_TRUE( world.has<Human>(entity) );
+		ASSERT_TRUE( world.has<Health>(entity) );
+		ASSERT_TRUE( world.has<Hat>(entity) );
+		ASSERT_FALSE( world.has<Shoes>(entity) );
+		ASSERT_EQ( world.get<Health>(entity).percent, 50.0F );
+		ASSERT_EQ( world.find<Shoes>(entity), nullptr );
+	}
+
+	TEST(StaticWorld, AddComponent)
+	{
+		TestWorld world;
+		EntityId entity = world.create();
+		world.add( entity, Shoes{9.0F} );
+
+		ASSERT_EQ( world.get<Shoes>().size(), 1U );
+		ASSERT_EQ( world.get<Shoes>(entity).size, 9.0F );
+		ASSERT_THROW( world.get<Health>(entity), std::invalid_argument );
+
+		// Missing id below an existing id
+		const EntityId later = world.create( Shoes{10.0F} );
+		ASSERT_TRUE( world.remove<Shoes>( entity ) );
+		ASSERT_THROW( world.get<Shoes>(entity), std::invalid_argument );
+		ASSERT_EQ( world.get<Shoes>(later).size, 10.0F );
+	}
+
+	TEST(StaticWorld, View)
+	{
+		TestWorld world;
+		for ( auto id : { 1U, 2U, 3U } ) (void)world.create( Health{float(id)} );
+		(void)world.create( Health{4.0F}, Hat{} );
+
+		SubzeroECS::View<Health, Hat> view(world);
+		ASSERT_EQ( &view.getCollection<Health>(), &world.get<Health>() );
+
+		auto iEntity = view.begin();
+		ASSERT_NE( iEntity, view.end() );
+		ASSERT_EQ( iEntity.get<Health>().percent, 4.0F );
+		++iEntity;
+		ASSERT_EQ( iEntity, view.end() );
+	}
+
+	class HealSystem : public SubzeroECS::System<HealSystem, Health>
+	{
+	public:
+		template<typename WorldType>
+		HealSystem(WorldType& world) : SubzeroECS::System<HealSystem, Health>(world) {}
+
+		void processEntity(Iterator iEntity)
+		{
+			get<Health>(iEntity).percent += 10.0F;
+		}
+	};
+
+	TEST(StaticWorld, System)
+	{
+		TestWorld world;
+		EntityId entity = world.create( Health{50.0F} );
+
+		HealSystem system(world);
+		system.update();
+		ASSERT_EQ( world.get<Health>(entity).percent, 60.0F );
+	}
+
+	TEST(StaticWorld, ClearTransients)
+	{
+		StaticWorld<Health, InputEvent> world;
+		const EntityId player = world.create( Health{100.0F}, InputEvent{32U} );
+		ASSERT_EQ( world.get<InputEvent>( player ).key, 32U );
+
+		world.clearTransients();
+		ASSERT_FALSE( world.has<InputEvent>( player ) );
+		ASSERT_TRUE( world.has<Health>( player ) );
+
+		world.add( player, InputEvent{13U} );
+		ASSERT_EQ( world.get<InputEvent>().size(), 1U );
+	}
+
+	TEST(StaticWorld, Clear)
+	{
+		TestWorld world;
+		for ( uint32_t i = 0U; i < 10U; ++i )
+			world.create( Health{ float(i) }, Shoes{} );
+
+		world.clear();
+		ASSERT_EQ( world.get<Health>().size(), 0U );
+		ASSERT_EQ( world.get<Shoes>().size(), 0U );
+		ASSERT_EQ( world.create(), EntityId{0U} );
+	}
+
+} //END: Test
+} //END: SubzeroECS
@@ -0,0 +1,165 @@
+#include "SubzeroECS/World.hpp"
+#include "SubzeroECS/Collection.hpp"
+#include "SubzeroECS/System.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+namespace SubzeroECS {
+namespace Test {
+
+	/** System processing entities through the View Iterator */
+	class AgeIteratorSystem : public System<AgeIteratorSystem, Age, Health>
+	{
+	public:
+		AgeIteratorSystem(World& world) : System<AgeIteratorSystem, Age, Health>(world) {}
+
+		void processEntity(Iterator iEntity)
+		{
+			iEntity.get<Age>().age += 1U;
+			iEntity.get<Health>().percent -= 1.0F;
+		}
+	};
+
+	/** System with component access deduced from the processEntity signature */
+	class AgeComponentSystem : public System<AgeComponentSystem, Age, Health>
+	{
+	public:
+		AgeComponentSystem(World& world) : System<AgeComponentSystem, Age, Health>(world) {}
+
+		void processEntity(Health& health, Age& age, EntityId entityId)
+		{
+			age.age += 1U;
+			health.percent -= 1.0F;
+			lastEntityId = entityId;
+		}
+
+		EntityId lastEntityId = EntityId::Invalid;
+	};
+
+	template< typename SystemType >
+	void testAgeSystem()
+	{
+		World world;
+		Collection<Age, Health> collections(world);
+		Entity entityA = world.create( Age{10U}, Health{50.0F} );
+		Entity entityB = world.create( Age{20U} );
+		Entity entityC = world.create( Age{30U}, Health{100.0F} );
+
+		SystemType system(world);
+		system.update();
+
+		EXPECT_EQ( entityA.get<Age>().age, 11U );
+		EXPECT_EQ( entityA.get<Health>().percent, 49.0F );
+		EXPECT_EQ( entityB.get<Age>().age, 20U );
+		EXPECT_EQ( entityC.get<Age>().age, 31U );
+		EXPECT_EQ( entityC.get<Health>().percent, 99.0F );
+	}
+
+	TEST(System, ProcessEntityIterator)
+	{
+		testAgeSystem<AgeIteratorSystem>();
+	}
+
+	TEST(System, ProcessEntityComponents)
+	{
+		testAgeSystem<AgeComponentSystem>();
+	}
+
+	/** Records the entities processed by each slice */
+	class SliceSystem : public System<SliceSystem, Age>
+	{
+	public:
+		SliceSystem(World& world) : System<SliceSystem, Age>(world) {}
+
+		void processEntity(EntityId entityId, Age& age)
+		{
+			++age.age;
+			processed.push_back( entityId.value );
+		}
+
+		std::vector<uint32_t> processed;
+	};
+
+	TEST(System, UpdateSlice_Entities)
+	{
+		World world;
+		Collection<Age> collections(world);
+		for ( uint32_t id : { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U } ) world.add( EntityId{id}, Age{0U} );
+
+		SliceSystem system(world);
+		const SliceBudget budget{ 4U };
+		ASSERT_FALSE( system.updateSlice( budget ) );
+		ASSERT_EQ( system.processed, (std::vector<uint32_t>{ 1U, 2U, 3U, 4U }) );
+		ASSERT_EQ( system.cursor(), EntityId{4U} );
+
+		// Structural changes either side of the cursor
+		world.add( EntityId{0U}, Age{0U} );
+		world.add( EntityId{11U}, Age{0U} );
+
+		system.processed.clear();
+		ASSERT_FALSE( system.updateSlice( budget ) );
+		ASSERT_EQ( system.processed, (std::vector<uint32_t>{ 5U, 6U, 7U, 8U }) );
+
+		system.processed.clear();
+		ASSERT_TRUE( system.updateSlice( budget ) ); //< Reached the end
+		ASSERT_EQ( system.processed, (std::vector<uint32_t>{ 9U, 10U, 11U }) );
+		ASSERT_TRUE( isNull( system.cursor() ) );
+
+		system.processed.clear();
+		ASSERT_FALSE( system.updateSlice( budget ) ); //< Restarts from the beginning
+		ASSERT_EQ( system.processed, (std::vector<uint32_t>{ 0U, 1U, 2U, 3U }) );
+	}
+
+	TEST(System, UpdateSlice_Duration)
+	{
+		World world;
+		Collection<Age> collections(world);
+		for ( uint32_t id = 0U; id != 100U; ++id ) world.add( EntityId{id}, Age{0U} );
+
+		SliceSystem system(world);
+		ASSERT_FALSE( system.updateSlice( SliceBudget{ .maxDuration = std::chrono::microseconds{0} } ) );
+		ASSERT_EQ( system.processed.size(), SliceSystem::ClockCheckInterval ); //< Clock is only read at intervals
+
+		// Without a duration the entity budget alone ends the slice
+		system.processed.clear();
+		ASSERT_FALSE( system.updateSlice( SliceBudget{ .maxEntities = 50U } ) );
+		ASSERT_EQ( system.processed.size(), 50U );
+		system.processed.clear();
+		ASSERT_TRUE( system.updateSlice( SliceBudget{} ) );
+		ASSERT_EQ( system.processed.size(), 100U - 50U - SliceSystem::ClockCheckInterval );
+	}
+
+	/** Time-sliced system over an owning group */
+	class GroupSliceSystem : public System<GroupSliceSystem, Age, Health>
+	{
+	public:
+		GroupSliceSystem(World& world) : System<GroupSliceSystem, Age, Health>(world) {}
+
+		void processEntity(Iterator iEntity)
+		{
+			processed.push_back( static_cast<EntityId>(iEntity).value );
+		}
+
+		std::vector<uint32_t> processed;
+	};
+
+	TEST(System, UpdateSlice_Group)
+	{
+		World world;
+		Collection<Age, Health> collections(world);
+		for ( uint32_t id = 0U; id != 10U; ++id ) world.add( EntityId{id}, Age{id} );
+		for ( uint32_t id = 0U; id != 10U; id += 2U ) world.add( EntityId{id}, Health{1.0F} );
+
+		GroupSliceSystem system(world);
+		ASSERT_FALSE( system.updateSlice( SliceBudget{ 2U } ) );
+		world.add( EntityId{3U}, Health{1.0F} );
+		ASSERT_TRUE( system.updateSlice( SliceBudget{ 10U } ) );
+		ASSERT_EQ( system.processed, (std::vector<uint32_t>{ 0U, 2U, 3U, 4U, 6U, 8U }) );
+	}
+
+} //END: Test
+} //END: SubzeroECS
@@ -0,0 +1,63 @@
+#include "SubzeroECS/Utility/ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace SubzeroECS {
+	namespace Test
+	{
+		using Utility::ThreadPool;
+
+		TEST(ThreadPool, ForEachIndexVisitsAllOnce)
+		{
+			ThreadPool pool( 4U );
+			ASSERT_EQ( pool.size(), 4U );
+
+			for ( std::size_t count : { 0U, 1U, 3U, 1000U } )
+			{
+				std::vector<std::atomic<int>> visits( count );
+				pool.forEachIndex( count, [&]( std::size_t index ) { ++visits[index]; } );
+				for ( const std::atomic<int>& visit : visits )
+				{
+					ASSERT_EQ( visit.load(), 1 );
+				}
+			}
+		}
+
+		TEST(ThreadPool, StableAffinity)
+		{
+			ThreadPool pool( 3U );
+			constexpr std::size_t Count = 100U;
+
+			std::vector<std::thread::id> first( Count );
+			pool.forEachIndex( Count, [&]( std::size_t index ) { first[index] = std::this_thread::get_id(); } );
+			ASSERT_EQ( first.front(), std::this_thread::get_id() ); //< Caller runs the first slice
+
+			for ( int repeat = 0; repeat < 10; ++repeat )
+			{
+				std::vector<std::thread::id> again( Count );
+				pool.forEachIndex( Count, [&]( std::size_t index ) { again[index] = std::this_thread::get_id(); } );
+				ASSERT_EQ( again, first );
+			}
+		}
+
+		TEST(ThreadPool, RethrowsException)
+		{
+			ThreadPool pool( 2U );
+			std::atomic<int> visits = 0;
+			ASSERT_THROW( pool.forEachIndex( 10U, [&]( std::size_t index )
+			{
+				++visits;
+				if ( index == 7U ) throw std::runtime_error("failed");
+			}), std::runtime_error );
+			ASSERT_EQ( visits.load(), 8 ); //< The other slice completes, the throwing slice [5,10) stops at 7
+
+			pool.forEachIndex( 10U, [&]( std::size_t ) { ++visits; } );
+			ASSERT_EQ( visits.load(), 18 );
+		}
+	}
+} //END: SubzeroECS
@@ -6,6 +6,10 @@
 #include "TestTypes.hpp"
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <ranges>
+#include <span>
+
 
 namespace SubzeroECS {	
 	namespace Test {
@@ -202,5 +206,182 @@ namespace SubzeroECS {
 			EXPECT_EQ( view.end(), iEntity );
 		}
 
+		TEST( View, Count1 )
+		{
+			World world;
+			Collection<Human> collections(world);
+			View<Human> view(world);
+			ASSERT_TRUE( view.empty() );
+			ASSERT_EQ( view.count(), 0U );
+
+			for ( auto humanId : { 1U, 2U, 3U } ) world.add( EntityId{humanId}, Human() );
+			ASSERT_FALSE( view.empty() );
+			ASSERT_EQ( view.count(), 3U );
+		}
+
+		TEST( View, Count3 )
+		{
+			World world;
+			Collection<Human,Hat,Health> collections(world);
+			View<Hat,Human,Health> view(world); //< Intersected as order differs from the owning group
+			View<Human,Hat,Health> groupView(world);
+			ASSERT_TRUE( view.empty() );
+			ASSERT_TRUE( groupView.empty() );
+
+			for ( auto humanId  : { 1U, 2U, 3U, 4U, 5U, 8U } ) world.add( EntityId{humanId}, Human() );
+			for ( auto hatId    : { 3U, 5U, 6U, 7U, 8U, 9U, 10U } ) world.add( EntityId{hatId}, Hat() );
+			ASSERT_TRUE( view.empty() ); //< No Health yet
+			ASSERT_EQ( view.count(), 0U );
+
+			for ( auto healthId : { 1U, 3U, 5U, 8U, 9U } ) world.add( EntityId{healthId}, Health{100.0F} );
+			ASSERT_FALSE( view.empty() );
+			ASSERT_EQ( view.count(), 3U );
+			ASSERT_FALSE( groupView.empty() );
+			ASSERT_EQ( groupView.count(), 3U );
+		}
+
+		TEST( View, Each1 )
+		{
+			World world;
+			Collection<Age> collections(world);
+			View<Age> view(world);
+
+			for ( auto id : { 1U, 2U, 3U, 4U, 5U, 8U, 9U } ) world.add( EntityId{id}, Age{id} );
+
+			std::vector<uint32_t> visited;
+			view.each( [&]( EntityId entityId, const Age& age )
+			{
+				EXPECT_EQ( entityId.value, age.age );
+				visited.push_back( age.age );
+			});
+			EXPECT_EQ( visited, (std::vector<uint32_t>{ 1U, 2U, 3U, 4U, 5U, 8U, 9U }) );
+		}
+
+		TEST( View, Each3_DeducedOrder )
+		{
+			World world;
+			Collection<Age,Health,Shoes> collections(world);
+			View<Shoes,Age,Health> view(world); //< Differs from callable parameter order
+
+			for ( auto id : { 1U, 2U, 3U, 4U, 5U, 8U } ) world.add( EntityId{id}, Age{id} );
+			for ( auto id : { 3U, 5U, 6U, 7U, 8U, 9U, 10U  } ) world.add( EntityId{id}, Health{id*2.0F} );
+			for ( auto id : { 1U, 3U, 5U, 8U, 9U } ) world.add( EntityId{id}, Shoes{id*3.0F} );
+
+			std::vector<uint32_t> visited;
+			view.each( [&]( const Age& age, Health& health, const Shoes& shoes, EntityId entityId )
+			{
+				EXPECT_EQ( entityId.value, age.age );
+				EXPECT_EQ( health, Health{age.age*2.0F} );
+				EXPECT_EQ( shoes, Shoes{age.age*3.0F} );
+				health.percent = 0.0F;
+				visited.push_back( age.age );
+			});
+			EXPECT_EQ( visited, (std::vector<uint32_t>{ 3U, 5U, 8U }) );
+			EXPECT_EQ( world.get<Health>( EntityId{5U} ).percent, 0.0F );
+			EXPECT_EQ( world.get<Health>( EntityId{6U} ).percent, 12.0F );
+		}
+
+		TEST( View, Each2_Generic )
+		{
+			World world;
+			Collection<Human,Hat> collections(world);
+			View<Human,Hat> view(world);
+
+			for ( auto humanId : { 1U, 2U, 3U, 4U, 5U, 8U, 9U } ) world.add( EntityId{humanId}, Human() );
+			for ( auto hatId   : { 1U, 5U, 6U, 7U, 8U, 9U } ) world.add( EntityId{hatId}, Hat() );
+
+			std::vector<EntityId> visited;
+			view.each( [&]( EntityId entityId, auto&, auto& ) { visited.push_back( entityId ); } );
+			EXPECT_EQ( visited, (std::vector<EntityId>{ EntityId{1U}, EntityId{5U}, EntityId{8U}, EntityId{9U} }) );
+		}
+
+		static_assert( std::contiguous_iterator< View<Age>::RowIterator > );
+		static_assert( std::random_access_iterator< View<Age,Health>::RowIterator > );
+		static_assert( std::is_same_v< View<Age>::Rows, std::span<Age> > ); //< Column itself
+		static_assert( std::is_same_v< std::iterator_traits< View<Age>::RowIterator >::iterator_category, std::random_access_iterator_tag > );
+		static_assert( std::is_same_v< std::iterator_traits< View<Age,Health>::RowIterator >::iterator_category, std::random_access_iterator_tag > );
+		static_assert( std::ranges::random_access_range< View<Age>::Rows > );
+
+		TEST( View, Rows1 )
+		{
+			World world;
+			Collection<Age> collections(world);
+			View<Age> view(world);
+			ASSERT_TRUE( view.rows().empty() );
+
+			for ( auto id : { 1U, 2U, 3U, 4U, 5U, 8U, 9U } ) world.add( EntityId{id}, Age{id} );
+
+			auto rows = view.rows();
+			ASSERT_EQ( rows.size(), 7U );
+			EXPECT_EQ( rows.data(), collections.components().data() );
+			EXPECT_EQ( rows[5].age, 8U );
+			EXPECT_EQ( (*(rows.end() - 1)).age, 9U );
+
+			std::ranges::for_each( rows, []( Age& age ) { age.age *= 2U; } );
+			EXPECT_EQ( world.get<Age>( EntityId{4U} ).age, 8U );
+		}
+
+		TEST( View, RowsIntersected )
+		{
+			World world;
+			Collection<Age,Health,Shoes> collections(world);
+			View<Shoes,Age> view(world); //< No owning group so rows are built by the view
+
+			for ( auto id : { 1U, 2U, 3U, 4U, 5U, 8U } ) world.add( EntityId{id}, Age{id} );
+			for ( auto id : { 1U, 3U, 5U, 8U, 9U } ) world.add( EntityId{id}, Shoes{id*3.0F} );
+
+			auto rows = view.rows();
+			ASSERT_EQ( rows.size(), 4U );
+			for ( std::size_t i = 0U; i != rows.size(); ++i )
+			{
+				auto [shoes, age] = rows[i];
+				EXPECT_EQ( shoes.size, age.age * 3.0F );
+			}
+
+			// Appended entities are picked up on the next call
+			world.add( EntityId{9U}, Age{9U} );
+			rows = view.rows();
+			ASSERT_EQ( rows.size(), 5U );
+			EXPECT_EQ( rows.back().id(), EntityId{9U} );
+		}
+
+		TEST( View, RowsGroup )
+		{
+			World world;
+			Collection<Age,Health> collections(world);
+			View<Age,Health> view(world);
+			ASSERT_NE( view.group(), nullptr );
+
+			for ( auto id : { 1U, 2U, 3U } ) world.add( EntityId{id}, Age{id} );
+			for ( auto id : { 2U, 3U, 4U } ) world.add( EntityId{id}, Health{id*2.0F} );
+
+			auto rows = view.rows();
+			ASSERT_EQ( rows.size(), 2U );
+			auto iFind = std::ranges::find_if( rows, []( auto entity ) { return entity.template get<Health>().percent == 6.0F; } );
+			ASSERT_NE( iFind, rows.end() );
+			EXPECT_EQ( (*iFind).id(), EntityId{3U} );
+			EXPECT_EQ( iFind - rows.begin(), 1 );
+		}
+
+		TEST( View, StructuredBindings )
+		{
+			World world;
+			Collection<Health,Shoes> collections(world);
+			View<Health,Shoes> view(world);
+
+			for ( auto id : { 1U, 2U, 3U, 4U, 5U, 8U, 9U } ) world.add( EntityId{id}, Health{id*2.0F} );
+			for ( auto id : { 1U, 5U, 6U, 7U, 8U, 9U } ) world.add( EntityId{id}, Shoes{id*3.0F} );
+
+			std::vector<float> visited;
+			for ( auto [health, shoes] : view )
+			{
+				EXPECT_EQ( health.percent * 1.5F, shoes.size );
+				visited.push_back( health.percent );
+				health.percent = 0.0F;
+			}
+			EXPECT_EQ( visited, (std::vector<float>{ 2.0F, 10.0F, 16.0F, 18.0F }) );
+			EXPECT_EQ( world.get<Health>( EntityId{5U} ).percent, 0.0F );
+		}
+
 	} //END: Test
 } //END: SubzeroECS
\ No newline at end of file
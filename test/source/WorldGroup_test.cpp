@@ -0,0 +1,107 @@
+#include "SubzeroECS/WorldGroup.hpp"
+
+#include "TestTypes.hpp"
+#include <gtest/gtest.h>
+
+namespace SubzeroECS {
+namespace Test {
+
+	using TestGroup = WorldGroup<Health, Shoes>;
+
+	/** Heals every entity by a fixed amount */
+	class ShardHealSystem : public System<ShardHealSystem, Health>
+	{
+	public:
+		template< typename WorldType >
+		ShardHealSystem( WorldType& world, float amount )
+		: System<ShardHealSystem, Health>(world)
+		, amount_(amount)
+		{}
+
+		void processEntity( Health& health )
+		{ health.percent += amount_; }
+
+	private:
+		float amount_;
+	};
+
+	/** Sets the shoe size of entities with Health to their health */
+	class ShardShoeSystem : public System<ShardShoeSystem, Health, Shoes>
+	{
+	public:
+		template< typename WorldType >
+		ShardShoeSystem( WorldType& world )
+		: System<ShardShoeSystem, Health, Shoes>(world)
+		{}
+
+		void processEntity( const Health& health, Shoes& shoes )
+		{ shoes.size = health.percent; }
+	};
+
+	TEST(WorldGroup, CreateWorlds)
+	{
+		TestGroup group( 2U );
+		ASSERT_EQ( group.threadCount(), 2U );
+		ASSERT_EQ( group.size(), 0U );
+
+		TestGroup::WorldType& world = group.createWorld();
+		ASSERT_EQ( group.size(), 1U );
+		ASSERT_EQ( &group.world(0U), &world );
+	}
+
+	TEST(WorldGroup, UpdateStepsAllWorldsInSystemOrder)
+	{
+		TestGroup group( 3U );
+		group.addSystem<ShardHealSystem>( 1.0F ); //< Added before the worlds
+
+		constexpr std::size_t WorldCount = 40U;
+		for ( std::size_t index = 0U; index < WorldCount; ++index )
+		{
+			TestGroup::WorldType& world = group.createWorld();
+			for ( std::size_t entity = 0U; entity <= index; ++entity )
+			{
+				(void)world.create( Health{ float(index) }, Shoes{ 0.0F } );
+			}
+		}
+		group.addSystem<ShardShoeSystem>(); //< Added after the worlds
+
+		group.update();
+		group.update();
+
+		for ( std::size_t index = 0U; index < WorldCount; ++index )
+		{
+			TestGroup::WorldType& world = group.world(index);
+			ASSERT_EQ( world.get<Health>().size(), index + 1U );
+			for ( const Health& health : world.get<Health>().components() )
+			{
+				ASSERT_EQ( health.percent, float(index) + 2.0F );
+			}
+			for ( const Shoes& shoes : world.get<Shoes>().components() )
+			{
+				ASSERT_EQ( shoes.size, float(index) + 2.0F );
+			}
+		}
+	}
+
+	TEST(WorldGroup, ForEachWorld)
+	{
+		TestGroup group( 2U );
+		for ( int index = 0; index < 5; ++index )
+		{
+			(void)group.createWorld();
+		}
+
+		group.forEachWorld( []( TestGroup::WorldType& world, std::size_t index )
+		{
+			(void)world.create( Health{ float(index) } );
+		});
+
+		for ( std::size_t index = 0U; index < group.size(); ++index )
+		{
+			ASSERT_EQ( group.world(index).get<Health>().size(), 1U );
+			ASSERT_EQ( group.world(index).get<Health>().components()[0].percent, float(index) );
+		}
+	}
+
+} //END: Test
+} //END: SubzeroECS
@@ -3,12 +3,24 @@
 #include "SubzeroECS/Has.hpp"
 #include "SubzeroECS/Query.hpp"
 #include "SubzeroECS/Logical.hpp"
+#include "SubzeroECS/View.hpp"
 
 #include "TestTypes.hpp"
 #include <gtest/gtest.h>
 
 
-namespace SubzeroECS {	
+namespace SubzeroECS {
+namespace Test {
+
+	/** One-frame event component */
+	struct HitEvent
+	{
+		float damage;
+	};
+}
+
+	template<> struct ComponentTransient<Test::HitEvent> : std::true_type {};
+
 namespace Test {
 		
 	TEST(World, CreateEntity)
@@ -88,6 +100,70 @@ namespace Test {
 		ASSERT_EQ(entity3.id().value, entity2.id().value + 1);
 	}
 
+	TEST(World, GetMany)
+	{
+		World world;
+		Collection<Health> healthCollection(world);
+
+		Entity entityA = world.create( Health{10.0f} );
+		Entity entityB = world.create();
+		Entity entityC = world.create( Health{30.0f} );
+
+		const EntityId entityIds[] = { entityC.id(), entityB.id(), entityA.id() };
+		Health* healths[3] = {};
+		world.getMany<Health>( entityIds, healths );
+
+		ASSERT_NE(healths[0], nullptr);
+		ASSERT_EQ(healths[0]->percent, 30.0f);
+		ASSERT_EQ(healths[1], nullptr);
+		ASSERT_NE(healths[2], nullptr);
+		ASSERT_EQ(healths[2]->percent, 10.0f);
+	}
+
+	TEST(World, CountQuery)
+	{
+		World world;
+		Collection<Human, Health, Hat> collections(world);
+
+		ASSERT_EQ(world.count(Has<Human>()), 0U);
+		ASSERT_FALSE(world.any(Has<Human>()));
+
+		(void)world.create(Human{}, Health{50.0f});
+		(void)world.create(Human{}, Health{100.0f}, Hat{});
+		(void)world.create(Human{});
+		(void)world.create(Health{75.0f});
+
+		ASSERT_EQ(world.count(Has<Human>()), 3U);
+		ASSERT_EQ(world.count(Has<Human>() && Has<Health>()), 2U);
+		ASSERT_EQ(world.count(Has<Health>() > Health{60.0f}), 2U);
+		ASSERT_EQ(world.count(Has<Human>() && (Has<Health>() > Health{60.0f})), 1U);
+		ASSERT_TRUE(world.any(Has<Hat>() && Has<Human>()));
+		ASSERT_FALSE(world.any(Has<Hat>() && (Has<Health>() < Health{60.0f})));
+
+		// Chains of Has<> are intersected on ids alone
+		static_assert(QueryIdsOnly<decltype(Has<Human>() && Has<Health>() && Has<Hat>())>::value);
+		static_assert(!QueryIdsOnly<decltype(Has<Human>() && (Has<Health>() > Health{60.0f}))>::value);
+		ASSERT_EQ(world.count(Has<Human>() && Has<Health>() && Has<Hat>()), 1U);
+		ASSERT_EQ(world.count(Has<Health>() && Has<Health>()), 3U);
+		ASSERT_TRUE(world.any(Has<Health>() && Has<Human>()));
+		ASSERT_FALSE(world.any(Has<Human>() && Has<Glasses>())); //< Unregistered component
+	}
+
+	/** Query with no required components, evaluated for every created entity */
+	struct EvenIdQuery : Query
+	{
+		bool operator() (const Entity& entity) const
+		{ return entity.id().value % 2U == 0U; }
+	};
+
+	TEST(World, CountQuery_AllEntities)
+	{
+		World world;
+		ASSERT_EQ(world.count(EvenIdQuery()), 0U);
+		for ( int i = 0; i != 5; ++i ) (void)world.create();
+		ASSERT_EQ(world.count(EvenIdQuery()), 3U); //< Ids 0, 2, 4
+	}
+
 	TEST(World, AsCollectionRegistry)
 	{
 		World world;
@@ -98,5 +174,54 @@ namespace Test {
 		ASSERT_EQ(&registry.get<Human>(), &humanCollection);
 	}
 
+	TEST(World, ClearTransients)
+	{
+		World world;
+		Collection<Health, HitEvent> collections(world);
+		const Entity target = world.create( Health{100.0F} );
+		const Entity other = world.create( Health{50.0F} );
+
+		for ( int frame = 0; frame < 3; ++frame )
+		{
+			world.add( target.id(), HitEvent{10.0F} );
+			world.add( other.id(), HitEvent{5.0F} );
+
+			// Events are read through normal views during the frame
+			View<Health, HitEvent> hits(world);
+			hits.each( []( Health& health, const HitEvent& hit ) { health.percent -= hit.damage; } );
+
+			const std::size_t capacity = collections.get<HitEvent>().components().capacity();
+			world.clearTransients();
+			ASSERT_EQ( collections.get<HitEvent>().size(), 0U );
+			ASSERT_EQ( collections.get<HitEvent>().components().capacity(), capacity );
+			ASSERT_FALSE( world.has<HitEvent>( target.id() ) );
+		}
+
+		// Persistent components are untouched
+		ASSERT_EQ( world.get<Health>( target.id() ).percent, 70.0F );
+		ASSERT_EQ( world.get<Health>( other.id() ).percent, 35.0F );
+	}
+
+	TEST(World, Clear)
+	{
+		World world;
+		Collection<Health, Hat> collections(world);
+		for ( uint32_t i = 0U; i < 100U; ++i )
+			world.create( Health{ float(i) }, Hat{} );
+		const std::size_t capacity = collections.get<Health>().components().capacity();
+
+		world.clear();
+		ASSERT_EQ( collections.get<Health>().size(), 0U );
+		ASSERT_EQ( collections.get<Hat>().size(), 0U );
+		ASSERT_EQ( collections.get<Health>().components().capacity(), capacity );
+		ASSERT_EQ( (View<Health, Hat>(world).count()), 0U );
+
+		// Ids restart and the collections remain registered
+		const Entity entity = world.create( Health{ 1.0F } );
+		ASSERT_EQ( entity.id(), EntityId{0U} );
+		ASSERT_EQ( &world.get<Health>( entity.id() ), collections.get<Health>().find( entity.id() ) );
+		ASSERT_FALSE( world.has<Hat>( entity.id() ) );
+	}
+
 } //END: Test
-} //END: SubzeroECS
\ No newline at end of file
+} //END: SubzeroECS